@@ -15,7 +15,9 @@
 #include <cppurses/system/keyboard_data.hpp>
 #include <cppurses/system/mouse_data.hpp>
 #include <cppurses/widget/focus_policy.hpp>
+#include <cppurses/widget/area.hpp>
 #include <cppurses/widget/point.hpp>
+#include <cppurses/widget/rect.hpp>
 #include <cppurses/widget/widget.hpp>
 
 #include "cell.hpp"
@@ -183,7 +185,7 @@ bool GoL_widget::mouse_press_event(const Mouse_data& mouse) {
     } else {
         engine_.give_life(engine_position);
     }
-    this->update();
+    this->update(Rect{mouse.local, Area{1, 1}});
     return Widget::mouse_press_event(mouse);
 }
 
@@ -1,7 +1,6 @@
 #ifndef CPPURSES_CPPURSES_TERMINAL_HPP
 #define CPPURSES_CPPURSES_TERMINAL_HPP
 
-#include <cppurses/terminal/input.hpp>
 #include <cppurses/terminal/output.hpp>
 #include <cppurses/terminal/terminal.hpp>
 
@@ -11,6 +11,7 @@
 #include <cppurses/widget/widgets/confirm_button.hpp>
 #include <cppurses/widget/widgets/cycle_box.hpp>
 #include <cppurses/widget/widgets/cycle_stack.hpp>
+#include <cppurses/widget/widgets/frame_profiler.hpp>
 #include <cppurses/widget/widgets/glyph_select.hpp>
 #include <cppurses/widget/widgets/glyph_select_stack.hpp>
 #include <cppurses/widget/widgets/horizontal_scrollbar.hpp>
@@ -19,7 +19,7 @@ enum class Attribute : std::int8_t {
 
 /// Global list of all Attributes.
 /** Useful if querying a Brush for each Attribute with the
- *  Brush::has_attribute() function. Brush holds a std::bitset internally making
+ *  Brush::has_attribute() function. Brush holds a bit mask internally making
  *  a query about a specific Attribute quick. Returning a list of all set
  *  Attributes is expensive, requiring an allocation if using std::vector. Might
  *  change in the future to give a better interface. */
@@ -1,6 +1,7 @@
 #ifndef CPPURSES_PAINTER_BRUSH_HPP
 #define CPPURSES_PAINTER_BRUSH_HPP
-#include <bitset>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
 
 #include <optional/optional.hpp>
@@ -11,6 +12,8 @@
 namespace cppurses {
 
 /// Holds the look of any paintable object with Attributes and Colors.
+/** Packed into a single 32 bit integer, so that Brushes are cheap to copy and
+ *  compare. */
 class Brush {
    public:
     /// Construct a Brush with given Attributes and Colors.
@@ -32,37 +35,67 @@ class Brush {
     }
 
     /// Set the background color of this brush.
-    void set_background(Color color) { background_color_ = color; }
+    void set_background(Color color) {
+        this->set_color_code(background_shift, encode(color));
+    }
 
     /// Set the foreground color of this brush.
-    void set_foreground(Color color) { foreground_color_ = color; }
+    void set_foreground(Color color) {
+        this->set_color_code(foreground_shift, encode(color));
+    }
 
     /// Remove a specific Attribute, if it is set, otherwise no-op.
-    void remove_attribute(Attribute attr) {
-        attributes_.set(static_cast<std::int8_t>(attr), false);
-    }
+    void remove_attribute(Attribute attr) { bits_ &= ~attribute_bit(attr); }
 
     /// Sets the background to not have a color, the default state.
-    void remove_background() { background_color_ = opt::none; }
+    void remove_background() { this->set_color_code(background_shift, 0); }
 
     /// Sets the foreground to not have a color, the default state.
-    void remove_foreground() { foreground_color_ = opt::none; }
+    void remove_foreground() { this->set_color_code(foreground_shift, 0); }
 
     /// Removes all of the set Attributes from the brush, not including colors.
-    void clear_attributes() { attributes_.reset(); }
+    void clear_attributes() { bits_ &= ~attributes_mask; }
 
     /// Provides a check if the brush has the provided Attribute \p attr.
     bool has_attribute(Attribute attr) const {
-        return attributes_[static_cast<std::size_t>(attr)];
+        return (bits_ & attribute_bit(attr)) != 0;
     }
 
     /// Returns the current background as an opt::Optional object.
-    opt::Optional<Color> background_color() const { return background_color_; }
+    opt::Optional<Color> background_color() const {
+        return this->color_at(background_shift);
+    }
 
     /// Returns the current foreground as an opt::Optional object.
-    opt::Optional<Color> foreground_color() const { return foreground_color_; }
+    opt::Optional<Color> foreground_color() const {
+        return this->color_at(foreground_shift);
+    }
+
+    /// Number of distinct color codes, including the code for no color.
+    static constexpr std::size_t color_code_count{17};
+
+    /// Returns the Attributes as a bit mask, bit n is set for Attribute n.
+    /** Along with the color codes, used to index lookup tables. */
+    std::uint8_t attribute_mask() const {
+        return static_cast<std::uint8_t>(bits_ & attributes_mask);
+    }
+
+    /// Returns the background color code, zero if there is no color.
+    /** Otherwise the code is one more than the offset of the Color from
+     *  detail::first_color_value. */
+    std::uint8_t background_code() const {
+        return static_cast<std::uint8_t>(this->color_code(background_shift));
+    }
+
+    /// Returns the foreground color code, zero if there is no color.
+    /** Otherwise the code is one more than the offset of the Color from
+     *  detail::first_color_value. */
+    std::uint8_t foreground_code() const {
+        return static_cast<std::uint8_t>(this->color_code(foreground_shift));
+    }
 
     friend bool operator==(const Brush& lhs, const Brush& rhs);
+    friend void imprint(const Brush& from, Brush& to);
 
    private:
     /// Used by add_attributes() to set a deail::BackgroundColor.
@@ -76,18 +109,50 @@ class Brush {
     }
 
     /// Used by add_attributes() to set an Attribute.
-    void set_attr(Attribute attr) {
-        attributes_.set(static_cast<std::int8_t>(attr));
+    void set_attr(Attribute attr) { bits_ |= attribute_bit(attr); }
+
+    // Bits [0, 8) hold Attributes, [8, 16) the background and [16, 24) the
+    // foreground. Colors are stored as a code, one more than their offset from
+    // detail::first_color_value, zero is no color.
+    static constexpr std::uint32_t attributes_mask{0xFF};
+    static constexpr std::uint32_t color_mask{0xFF};
+    static constexpr int background_shift{8};
+    static constexpr int foreground_shift{16};
+
+    std::uint32_t bits_{0};
+
+    static std::uint32_t attribute_bit(Attribute attr) {
+        return std::uint32_t{1} << static_cast<int>(attr);
+    }
+
+    static std::uint32_t encode(Color color) {
+        return static_cast<std::uint32_t>(static_cast<int>(color) -
+                                          detail::first_color_value + 1);
     }
 
-    // Data Members
-    std::bitset<8> attributes_;
-    opt::Optional<Color> background_color_;
-    opt::Optional<Color> foreground_color_;
+    std::uint32_t color_code(int shift) const {
+        return (bits_ >> shift) & color_mask;
+    }
+
+    void set_color_code(int shift, std::uint32_t code) {
+        bits_ = (bits_ & ~(color_mask << shift)) | (code << shift);
+    }
+
+    opt::Optional<Color> color_at(int shift) const {
+        opt::Optional<Color> color;
+        const auto code = this->color_code(shift);
+        if (code != 0) {
+            color = static_cast<Color>(static_cast<int>(code) - 1 +
+                                       detail::first_color_value);
+        }
+        return color;
+    }
 };
 
 /// Compares if the held attributes and (back/fore)ground colors are equal.
-bool operator==(const Brush& lhs, const Brush& rhs);
+inline bool operator==(const Brush& lhs, const Brush& rhs) {
+    return lhs.bits_ == rhs.bits_;
+}
 
 /// Adds Attributes and Colors from \p from to \p to.
 /** Does not overwrite existing colors in \p to. */
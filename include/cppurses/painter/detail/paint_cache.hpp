@@ -0,0 +1,74 @@
+#ifndef CPPURSES_PAINTER_DETAIL_PAINT_CACHE_HPP
+#define CPPURSES_PAINTER_DETAIL_PAINT_CACHE_HPP
+#include <cstdint>
+
+#include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/detail/screen_descriptor.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/border.hpp>
+#include <cppurses/widget/point.hpp>
+
+namespace cppurses {
+class Widget;
+namespace detail {
+
+/// Holds the staged output of a Widget's last paint_event() for reuse.
+/** The output is reused while the content version, position, size, brush and
+ *  Border of the Widget are the same as when it was painted. The Border is
+ *  compared whole, its members are set directly. Only output painted with the
+ *  entire Widget damaged is kept. Disabled by default. */
+class Paint_cache {
+   public:
+    /// Enable or disable the cache, disabling drops the cached output.
+    void enable(bool enable = true) {
+        enabled_ = enable;
+        if (!enable) {
+            this->invalidate();
+        }
+    }
+
+    /// Returns true if the cache is enabled.
+    bool enabled() const { return enabled_; }
+
+    /// Increments the content version, the cached output is no longer used.
+    void content_changed() { ++version_; }
+
+    /// Stages the output of \p w.paint_event() in the current Event_loop.
+    /** Copies the cached output instead of calling paint_event() if nothing
+     *  it depends on has changed. Returns the result of paint_event(). */
+    bool paint(Widget& w);
+
+   private:
+    /// Everything a cached output depends on.
+    struct Key {
+        std::uint64_t version;
+        Point position;
+        Area size;
+        Brush brush;
+        Border border;
+    };
+
+    bool enabled_{false};
+    bool valid_{false};
+    bool handled_{false};
+    bool staged_{false};
+    std::uint64_t version_{0};
+    Key key_;
+    Screen_descriptor cells_;
+
+    /// Forget the cached output, the next paint() calls paint_event().
+    void invalidate() {
+        valid_ = false;
+        cells_ = Screen_descriptor{};
+    }
+
+    /// Returns the Key of \p w as it is now.
+    Key key_of(const Widget& w) const;
+
+    /// Returns true if \p x and \p y describe the same output.
+    static bool same(const Key& x, const Key& y);
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_PAINTER_DETAIL_PAINT_CACHE_HPP
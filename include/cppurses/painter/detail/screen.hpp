@@ -1,66 +1,88 @@
 #ifndef CPPURSES_PAINTER_DETAIL_SCREEN_HPP
 #define CPPURSES_PAINTER_DETAIL_SCREEN_HPP
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
 #include <cppurses/painter/detail/screen_descriptor.hpp>
 #include <cppurses/painter/detail/staged_changes.hpp>
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/widget/point.hpp>
 
 namespace cppurses {
 class Widget;
-struct Point;
 namespace detail {
 
 /// Writes uncommitted changes to the underlying paint engine.
-/** Also enables the cursor on the widget in focus. Implements optimizations
- *  if the tile already exists onscreen. All coordinates are global. */
+/** Also places the cursor on the widget in focus. Widgets are composed into a
+ *  terminal sized back buffer, which is then diffed against a front buffer
+ *  holding what is currently displayed; only changed cells are output. The
+ *  buffers are shared by all Screen objects, since there is a single terminal,
+ *  flush() holds a render mutex shared by all Screen objects. All coordinates
+ *  are global. */
 class Screen {
    public:
-    /// Puts the state of \p changes onto the physical screen.
-    void flush(const Staged_changes& changes);
+    /// What a single flush() sent to the terminal.
+    struct Flush_stats {
+        /// Number of cells output.
+        std::size_t cells{0};
 
-    /// Moves the cursor to the currently focused widget, if cursor enabled.
-    void set_cursor_on_focus_widget();
+        /// Number of bytes written, zero unless escape sequences are written.
+        std::size_t bytes{0};
+    };
+
+    /// Puts the state of \p changes onto the physical screen.
+    /** The cursor is placed on the focus widget in the same write. */
+    Flush_stats flush(const Staged_changes& changes);
 
    private:
-    /// Covers space unowned by any child widget with wallpaper.
-    /** Does nothing if w has no children. */
-    void paint_empty_tiles(const Widget& widg);
+    /// Serializes output to the terminal and use of the buffers.
+    static std::mutex render_mtx_;
 
-    // Covers points in w->screen_state that are not found in \p staged_tiles.
-    // Paints over tiles that existed on previous iteration but not on current.
-    void cover_leftovers(Widget& widg, const Screen_descriptor& staged_tiles);
+    /// Glyphs currently displayed on the terminal, unset if unknown.
+    static Screen_descriptor front_buffer_;
 
-    // Performs a full paint of a single tile at \p point.
-    // Paints either a wallpaper or staged change tile, unless the staged tile
-    // is the same as what is currently on screen.
-    void full_paint_single_point(Widget& widg,
-                                 const Screen_descriptor& staged_tiles,
-                                 const Point& point);
+    /// Glyphs composed for the next frame, only set where a Widget was painted.
+    static Screen_descriptor back_buffer_;
 
-    // Performs a basic paint of a single \p point.
-    // Only paints if the staged change tile is different from what is onscreen.
-    void basic_paint_single_point(Widget& widg, const Point& point, Glyph tile);
+    /// Changed cells in a single row that share a Brush, waiting for output.
+    static std::vector<Glyph> run_;
 
-    // Paints every point of \p widg with wallpaper or from \p staged_tiles.
-    void full_paint(Widget& widg, const Screen_descriptor& staged_tiles);
+    /// Whether the cursor was shown by the last flush(), and where.
+    static bool cursor_shown_;
+    static Point cursor_position_;
 
-    // Paints \p staged_tiles(if needed), and covers leftovers w/wallpaper.
-    void basic_paint(Widget& widg, const Screen_descriptor& staged_tiles);
+    /// Resizes both buffers if the terminal dimensions have changed.
+    /** Cells of the front buffer within the new dimensions are kept, unless
+     *  escape sequences are written directly, then all cells are forgotten. */
+    void fit_buffers_to_terminal();
 
-    // Used when a child has just been enabled after not being on the screen.
-    void paint_just_enabled(Widget& widg,
-                            const Screen_descriptor& staged_tiles);
+    /// Writes \p tile to the back buffer, no-op if \p point is off screen.
+    void put_back(const Point& point, const Glyph& tile);
 
-    // Repaints the empty space of the layout, then a basic paint of \p widg.
-    void paint_child_event(Widget& widg, const Screen_descriptor& staged_tiles);
+    /// Scrolls the terminal and the front buffer if \p widg has a scroll hint.
+    /** Only if the hinted band covers at least half of the screen width, as
+     *  entire rows are scrolled. Cells of those rows outside of the band are
+     *  restored to their previous Glyphs via the back buffer. Clears the
+     *  hint. */
+    void apply_scroll_hint(Widget& widg);
 
-    // Paints tiles based on a Screen_mask created by Resize_event::send();
-    void paint_resize_event(Widget& widg,
-                            const Screen_descriptor& staged_tiles);
+    /// Writes every damaged point of \p widg to the back buffer.
+    /** Points are taken from \p staged_tiles with the Widget's brush imprinted,
+     *  or are wallpaper if \p widg has no children or no child covers them.
+     *  Clears the damage of \p widg. */
+    void compose(Widget& widg, const Screen_descriptor& staged_tiles);
 
-    // TODO Implement with optimizations, currently performs full repaint.
-    void paint_move_event(Widget& widg, const Screen_descriptor& staged_tiles);
+    /// Outputs each cell of the back buffer that differs from the front buffer.
+    /** Horizontally adjacent changed cells with the same Brush are output as a
+     *  single run. Updates the front buffer and clears the back buffer. Returns
+     *  the number of cells output. */
+    std::size_t commit_back_buffer();
 
-    // Calls on the correct optimizing function to paint.
-    void delegate_paint(Widget& widg, const Screen_descriptor& staged_tiles);
+    /// Shows the cursor on the focus widget, if cursor enabled, else hides it.
+    /** The position is written out by the next output::refresh(). Returns true
+     *  if the cursor was shown, hidden or moved since the last call. */
+    bool set_cursor_on_focus_widget();
 };
 
 }  // namespace detail
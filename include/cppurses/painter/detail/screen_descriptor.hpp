@@ -1,15 +1,115 @@
 #ifndef CPPURSES_PAINTER_DETAIL_SCREEN_DESCRIPTOR_HPP
 #define CPPURSES_PAINTER_DETAIL_SCREEN_DESCRIPTOR_HPP
-#include <unordered_map>
+#include <cstddef>
+#include <vector>
 
 #include <cppurses/painter/glyph.hpp>
+#include <cppurses/widget/area.hpp>
 #include <cppurses/widget/point.hpp>
 
 namespace cppurses {
+class Widget;
 namespace detail {
 
 /// Holds the screen state by Points on the screen and cooresponding Glyphs.
-using Screen_descriptor = std::unordered_map<Point, Glyph>;
+/** Stored as a dense, row-major grid of Glyphs bounded by a rectangle in
+ *  global coordinates, usually the outer area of a Widget. A bitmap marks
+ *  which cells have had a Glyph set, unset cells are not part of the state. */
+class Screen_descriptor {
+   public:
+    /// Create an empty Screen_descriptor with size (0,0).
+    Screen_descriptor() = default;
+
+    /// Create an empty Screen_descriptor bounded by \p area at \p offset.
+    Screen_descriptor(const Point& offset, const Area& area);
+
+    /// Create an empty Screen_descriptor bounded by the outer area of \p w.
+    explicit Screen_descriptor(const Widget& w);
+
+    /// Return the offset of the bounds on the screen, top left point.
+    Point offset() const { return offset_; }
+
+    /// Return the area of the bounds. Width and Height.
+    Area area() const { return area_; }
+
+    /// Set the bounds to \p area at \p offset.
+    /** Glyphs that are within both the old and the new bounds are kept, all
+     *  others are dropped. No-op if the bounds are already equal. */
+    void fit_to(const Point& offset, const Area& area);
+
+    /// Set the bounds to the outer area of \p w.
+    void fit_to(const Widget& w);
+
+    /// Returns true if \p p is within the bounds of the Screen_descriptor.
+    bool within_bounds(const Point& p) const {
+        return p.x >= offset_.x && p.y >= offset_.y &&
+               p.x < offset_.x + area_.width && p.y < offset_.y + area_.height;
+    }
+
+    /// Returns true if a Glyph is set at \p p.
+    bool contains(const Point& p) const {
+        return this->within_bounds(p) && is_set_[this->index_at(p)];
+    }
+
+    /// Returns the number of Glyphs set.
+    std::size_t size() const { return count_; }
+
+    /// Returns true if no Glyphs are set.
+    bool empty() const { return count_ == 0; }
+
+    /// Set the Glyph at \p p. No bounds checking.
+    void set(const Point& p, const Glyph& tile) {
+        const auto index = this->index_at(p);
+        if (!is_set_[index]) {
+            is_set_[index] = true;
+            ++count_;
+        }
+        glyphs_[index] = tile;
+    }
+
+    /// Retrieve the Glyph at \p p. No bounds checking, the Glyph must be set.
+    const Glyph& at(const Point& p) const { return glyphs_[this->index_at(p)]; }
+
+    /// Unset the Glyph at \p p, no-op if not set or out of bounds.
+    void erase(const Point& p);
+
+    /// Unset all Glyphs, the bounds are kept.
+    void clear();
+
+    /// Move the rows [\p top, \p bottom) up by \p lines, negative is down.
+    /** Rows moved out of the range are dropped, rows moved into the range
+     *  are unset. Rows are in global coordinates and clipped to the bounds. */
+    void scroll_rows(std::size_t top, std::size_t bottom, std::ptrdiff_t lines);
+
+    /// Call \p f with the Point and Glyph of each set Glyph, in row order.
+    template <typename Function>
+    void for_each(Function&& f) const {
+        if (count_ == 0) {
+            return;
+        }
+        auto index = std::size_t{0};
+        const auto y_end = offset_.y + area_.height;
+        const auto x_end = offset_.x + area_.width;
+        for (auto y = offset_.y; y < y_end; ++y) {
+            for (auto x = offset_.x; x < x_end; ++x, ++index) {
+                if (is_set_[index]) {
+                    f(Point{x, y}, glyphs_[index]);
+                }
+            }
+        }
+    }
+
+   private:
+    Point offset_;
+    Area area_{0, 0};
+    std::size_t count_{0};
+    std::vector<Glyph> glyphs_;
+    std::vector<bool> is_set_;
+
+    std::size_t index_at(const Point& p) const {
+        return ((p.y - offset_.y) * area_.width) + (p.x - offset_.x);
+    }
+};
 
 }  // namespace detail
 }  // namespace cppurses
@@ -1,5 +1,7 @@
 #ifndef CPPURSES_PAINTER_DETAIL_STAGED_CHANGES_HPP
 #define CPPURSES_PAINTER_DETAIL_STAGED_CHANGES_HPP
+#include <unordered_map>
+
 #include <cppurses/painter/detail/screen_descriptor.hpp>
 
 namespace cppurses {
@@ -1,5 +1,7 @@
 #ifndef CPPURSES_PAINTER_GLYPH_HPP
 #define CPPURSES_PAINTER_GLYPH_HPP
+#include <cstdint>
+#include <cstring>
 #include <utility>
 
 #include <cppurses/painter/brush.hpp>
@@ -26,9 +28,17 @@ struct Glyph {
     Brush brush;
 };
 
+static_assert(sizeof(Glyph) == sizeof(std::uint64_t),
+              "Glyph must be packed into 8 bytes, without padding.");
+
 /// Compares if each symbol and brush are equal.
+/** Both are compared at once, as a single 64 bit integer. */
 inline bool operator==(const Glyph& lhs, const Glyph& rhs) {
-    return (lhs.symbol == rhs.symbol) && (lhs.brush == rhs.brush);
+    std::uint64_t l;
+    std::uint64_t r;
+    std::memcpy(&l, &lhs, sizeof(l));
+    std::memcpy(&r, &rhs, sizeof(r));
+    return l == r;
 }
 
 /// Compares if each symbol and brush are not equal.
@@ -20,7 +20,9 @@ class Painter {
     /// Construct an object ready to paint Glyphs to \p *widg.
     explicit Painter(Widget& widg)
         : widget_{widg},
-          staged_changes_{System::find_event_loop().staged_changes()[&widg]} {}
+          staged_changes_{System::find_event_loop().staged_changes()[&widg]} {
+        staged_changes_.fit_to(widget_);
+    }
 
     Painter(const Painter&) = delete;
     Painter(Painter&&) = delete;
@@ -78,15 +80,19 @@ class Painter {
 
    private:
     /// Puts a single Glyph to the staged_changes_ container.
-    /** No bounds checking, used internally for all painting. Main entry point
-     *  for modifying the staged_changes_ object. */
+    /** Only checks against the outer bounds of widget_, used internally for
+     *  all painting. Main entry point for modifying the staged_changes_ object.
+     */
     void put_global(const Glyph& tile, std::size_t x, std::size_t y) {
-        staged_changes_[Point{x, y}] = tile;
+        const auto position = Point{x, y};
+        if (staged_changes_.within_bounds(position)) {
+            staged_changes_.set(position, tile);
+        }
     }
 
     /// Puts a single Glyph to the staged_changes_ container.
-    /** No bounds checking, used internally for all painting. Main entry point
-     *  for modifying the staged_changes_ object. */
+    /** Only checks against the outer bounds of widget_, used internally for
+     *  all painting. */
     void put_global(const Glyph& tile, const Point& position) {
         this->put_global(tile, position.x, position.y);
     }
@@ -1,18 +1,15 @@
 #ifndef CPPURSES_SYSTEM_ANIMATION_ENGINE_HPP
 #define CPPURSES_SYSTEM_ANIMATION_ENGINE_HPP
 #include <functional>
-#include <thread>
-#include <unordered_map>
-#include <vector>
 
-#include <cppurses/system/detail/chrono_duration_hash.hpp>
 #include <cppurses/system/detail/timer_event_loop.hpp>
 
 namespace cppurses {
 class Widget;
-class Event_loop;
 
-/// Manages all Timer_event_loops, grouping by period.
+/// Manages the Timer_event_loop that keeps time for every animated Widget.
+/** A single timer thread serves every period, it is started by the first
+ *  registration. */
 class Animation_engine {
    public:
     using Period_t = detail::Timer_event_loop::Period_t;
@@ -27,7 +24,7 @@ class Animation_engine {
     /// Stop posting Timer_events to a given Widget.
     void unregister_widget(Widget& w);
 
-    /// Sends stop signals to all event loops and waits for them to exit.
+    /// Sends a stop signal to the timer thread.
     void shutdown();
 
     /// Starts sending Timer_events to all registered widgets.
@@ -35,8 +32,8 @@ class Animation_engine {
     void startup();
 
    private:
-    std::unordered_map<Period_t, detail::Timer_event_loop> const_loops_;
-    std::vector<detail::Timer_event_loop> variable_loops_;
+    detail::Timer_event_loop loop_;
+    bool running_{false};
 };
 
 }  // namespace cppurses
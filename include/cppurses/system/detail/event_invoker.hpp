@@ -1,5 +1,7 @@
 #ifndef CPPURSES_SYSTEM_DETAIL_EVENT_INVOKER_HPP
 #define CPPURSES_SYSTEM_DETAIL_EVENT_INVOKER_HPP
+#include <cstddef>
+
 #include <cppurses/system/event.hpp>
 
 namespace cppurses {
@@ -11,14 +13,23 @@ class Event_queue;
 /** If \p type_filter is not Event::None, then only the given Event::Type will
  *  be invoked. If \p object_filter is not nullptr, only Events with a receiver
  *  of that \p object_filter will be invoked. Events are processed by calling
- *  System::send_event() for each Event. Allows for more Events to be appended
- *  to the Event_queue as Events are processed. Once an Event has been invoked,
- *  it is erased from the \p queue. */
+ *  System::send_event() for each Event. Only the lane of the Event_queue that
+ *  holds \p type_filter Events is visited. Its pending Events are taken as a
+ *  batch and processed in a single pass, Events appended while processing are
+ *  processed in following batches. Events that are filtered out are put back
+ *  in front of the lane. Events for a Widget destroyed while its batch is
+ *  processed are dropped, see Event_queue::remove_events(). */
 class Event_invoker {
    public:
     void invoke(Event_queue& queue,
                 Event::Type type_filter = Event::None,
                 Widget* object_filter = nullptr);
+
+    /// Returns the number of Events sent by this Event_invoker.
+    std::size_t dispatched() const { return dispatched_; }
+
+   private:
+    std::size_t dispatched_{0};
 };
 
 }  // namespace detail
@@ -0,0 +1,104 @@
+#ifndef CPPURSES_SYSTEM_DETAIL_EVENT_MAILBOX_HPP
+#define CPPURSES_SYSTEM_DETAIL_EVENT_MAILBOX_HPP
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <cppurses/system/event.hpp>
+
+namespace cppurses {
+namespace detail {
+
+/// Lock-free inbox of Events posted to an Event_loop from other threads.
+/** Any number of threads can push(), a single thread, the Event_loop's own,
+ *  calls take_all(). Implemented as a linked stack that is swapped out whole by
+ *  the consumer, so there is no ABA problem. The link is held in each Event,
+ *  so pushing does not allocate. */
+class Event_mailbox {
+   public:
+    Event_mailbox() = default;
+    Event_mailbox(const Event_mailbox&) = delete;
+    Event_mailbox& operator=(const Event_mailbox&) = delete;
+
+    /// Not thread safe, \p other must not be in use.
+    Event_mailbox(Event_mailbox&& other) noexcept
+        : head_{other.head_.exchange(nullptr)} {}
+
+    /// Not thread safe, neither Event_mailbox can be in use.
+    Event_mailbox& operator=(Event_mailbox&& other) noexcept {
+        if (this != &other) {
+            this->clear();
+            head_ = other.head_.exchange(nullptr);
+        }
+        return *this;
+    }
+
+    ~Event_mailbox() { this->clear(); }
+
+    /// Adds \p event to the mailbox, can be called from any thread.
+    void push(std::unique_ptr<Event> event) {
+        if (event == nullptr) {
+            return;
+        }
+        Event* node = event.release();
+        node->mailbox_next_ = head_.load(std::memory_order_relaxed);
+        while (!head_.compare_exchange_weak(node->mailbox_next_, node,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+        }
+    }
+
+    /// Adds each of \p events to the mailbox in order, with a single exchange.
+    void push_all(std::vector<std::unique_ptr<Event>> events) {
+        Event* first{nullptr};
+        Event* last{nullptr};
+        for (auto& event : events) {
+            if (event == nullptr) {
+                continue;
+            }
+            event->mailbox_next_ = last;
+            last = event.release();
+            if (first == nullptr) {
+                first = last;
+            }
+        }
+        if (first == nullptr) {
+            return;
+        }
+        first->mailbox_next_ = head_.load(std::memory_order_relaxed);
+        while (!head_.compare_exchange_weak(first->mailbox_next_, last,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+        }
+    }
+
+    /// Empties the mailbox, calling \p f with each Event in the order pushed.
+    template <typename Function>
+    void take_all(Function&& f) {
+        Event* node = head_.exchange(nullptr, std::memory_order_acquire);
+        Event* reversed{nullptr};
+        while (node != nullptr) {
+            Event* next = node->mailbox_next_;
+            node->mailbox_next_ = reversed;
+            reversed = node;
+            node = next;
+        }
+        while (reversed != nullptr) {
+            Event* next = reversed->mailbox_next_;
+            reversed->mailbox_next_ = nullptr;
+            f(std::unique_ptr<Event>{reversed});
+            reversed = next;
+        }
+    }
+
+   private:
+    std::atomic<Event*> head_{nullptr};
+
+    void clear() {
+        this->take_all([](std::unique_ptr<Event>) {});
+    }
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_SYSTEM_DETAIL_EVENT_MAILBOX_HPP
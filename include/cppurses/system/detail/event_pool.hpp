@@ -0,0 +1,44 @@
+#ifndef CPPURSES_SYSTEM_DETAIL_EVENT_POOL_HPP
+#define CPPURSES_SYSTEM_DETAIL_EVENT_POOL_HPP
+#include <cstddef>
+
+namespace cppurses {
+namespace detail {
+
+/// Recycles the memory of Event objects, used by Event::operator new/delete.
+/** Each thread keeps free lists of blocks in a few size classes, so an Event
+ *  loop that posts and processes Events reuses the blocks of Events it has
+ *  already freed instead of going to the global allocator. Blocks can be freed
+ *  on a different thread than they were allocated on, each block is a
+ *  separate global allocation. Sizes above the largest class are passed
+ *  through to the global allocator. */
+class Event_pool {
+   public:
+    /// Allocation counters of a single thread.
+    struct Stats {
+        /// Number of Events allocated.
+        std::size_t allocations{0};
+
+        /// Number of Events allocated from a free list.
+        std::size_t reused{0};
+
+        /// Number of Events allocated with the global allocator.
+        std::size_t global_allocations{0};
+
+        /// Number of Events freed.
+        std::size_t deallocations{0};
+    };
+
+    /// Returns memory for an Event of \p size bytes.
+    static void* allocate(std::size_t size);
+
+    /// Frees memory returned by allocate(), \p size must be the same.
+    static void deallocate(void* block, std::size_t size) noexcept;
+
+    /// Returns the counters of the calling thread.
+    static Stats stats();
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_SYSTEM_DETAIL_EVENT_POOL_HPP
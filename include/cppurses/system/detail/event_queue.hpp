@@ -1,16 +1,24 @@
 #ifndef CPPURSES_SYSTEM_DETAIL_EVENT_QUEUE_HPP
 #define CPPURSES_SYSTEM_DETAIL_EVENT_QUEUE_HPP
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
+#include <cppurses/system/event.hpp>
+
 namespace cppurses {
-class Event;
+class Widget;
 namespace detail {
 
 /// Holds Events to be invoked at a later time.
 /** Events are added to an Event_queue by calling System::post_event(). Each
  *  Event_loop holds its own Event_queue, System::post_event() finds this
- *  Event_queue by the calling std::thread::id. */
+ *  Event_queue by the calling std::thread::id. Paint and Delete Events are held
+ *  in their own lanes, all other Events share a lane, each lane is FIFO. The
+ *  slot of the queued Event for each receiver and expensive Event::Type is
+ *  indexed, so duplicates are found in constant time. */
 class Event_queue {
    public:
     /// Moves \p event onto the Event_queue for later processing.
@@ -20,10 +28,85 @@ class Event_queue {
      *  Event_queue. */
     void append(std::unique_ptr<Event> event);
 
+    /// Returns true if there are no Events waiting to be processed.
+    bool empty() const {
+        return general_.size == 0 && paints_.size == 0 && deletes_.size == 0;
+    }
+
+    /// Removes every queued Event with \p receiver.
+    void remove_events(const Widget& receiver);
+
+    /// Removes every queued Event in the lane of \p type and returns them.
+    /** Paint and Delete Events each have their own lane, every other
+     *  Event::Type shares one. Events are returned in FIFO order. */
+    std::vector<std::unique_ptr<Event>> take_all(Event::Type type);
+
+    /// Returns the number of Paint_events removed as duplicates by append().
+    std::size_t coalesced_paints() const { return coalesced_paints_; }
+
     friend class Event_invoker;
 
    private:
-    std::vector<std::unique_ptr<Event>> queue_;
+    /// Identifies the single queued Event of an indexed Event::Type.
+    struct Key {
+        const Widget* receiver;
+        Event::Type type;
+
+        bool operator==(const Key& other) const {
+            return receiver == other.receiver && type == other.type;
+        }
+    };
+
+    struct Key_hash {
+        std::size_t operator()(const Key& key) const {
+            return std::hash<const Widget*>{}(key.receiver) ^
+                   (static_cast<std::size_t>(key.type) << 1);
+        }
+    };
+
+    /// Events in FIFO order, a removed Event leaves an empty slot.
+    using Batch = std::vector<std::unique_ptr<Event>>;
+
+    /// A Batch being filled, with the slot of each indexed Event.
+    /** in_flight is the Batch the Event_invoker is sending, it is not indexed
+     *  or counted, but remove_if() still empties its slots, so Events for a
+     *  Widget destroyed part way through the Batch are never sent. */
+    struct Lane {
+        Batch events;
+        std::unordered_map<Key, std::size_t, Key_hash> index;
+        std::size_t size{0};
+        Batch in_flight;
+    };
+
+    Lane general_;
+    Lane paints_;
+    Lane deletes_;
+    std::size_t coalesced_paints_{0};
+
+    /// Returns the Lane that holds Events of \p type.
+    Lane& lane_for(Event::Type type);
+
+    /// Moves every Event of the Lane of \p type to its in_flight Batch.
+    /** Events appended from now on start a new Batch. Returns the in_flight
+     *  Batch, an Event is moved out of its slot before it is sent. */
+    Batch& take_batch(Event::Type type);
+
+    /// Puts the in_flight Batch back in front of the Lane of \p type.
+    /** Empty slots are dropped, as are indexed Events that have been posted
+     *  again since the Batch was taken. */
+    void requeue(Event::Type type);
+
+    /// Removes the queued Event with \p receiver and \p type, if any.
+    /** Returns true if an Event was removed. */
+    bool remove(const Widget& receiver, Event::Type type);
+
+    /// Removes every queued Event with a descendant of \p receiver.
+    /** Each receiver's ancestry is checked, O(queue size x tree depth). */
+    void remove_descendant_events(const Widget& receiver);
+
+    /// Removes every queued Event for which \p predicate returns true.
+    template <typename Predicate>
+    void remove_if(Predicate&& predicate);
 };
 
 }  // namespace detail
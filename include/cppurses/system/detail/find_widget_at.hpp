@@ -10,7 +10,8 @@ namespace detail {
 /** Returns nullptr on failing to find a Widget with the provided coordinates.
  *  Returns the deepest child Widget that owns the coordinates. If a parent owns
  *  the coordinates, it is check if any of the childen own it as well before
- *  returning. Used only by NCurses_paint_engine at the moment. */
+ *  returning. Answered from the Hit_map, used to find the receiver of mouse
+ *  input. */
 Widget* find_widget_at(std::size_t x, std::size_t y);
 
 }  // namespace detail
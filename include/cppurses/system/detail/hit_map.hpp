@@ -0,0 +1,34 @@
+#ifndef CPPURSES_SYSTEM_DETAIL_HIT_MAP_HPP
+#define CPPURSES_SYSTEM_DETAIL_HIT_MAP_HPP
+#include <cstddef>
+
+namespace cppurses {
+class Widget;
+namespace detail {
+
+/// Cell to Widget ownership map of the screen, for O(1) hit-tests.
+/** Each cell covered by System::head() holds a compact index of the deepest
+ *  enabled Widget owning it, the same Widget a walk down from the head would
+ *  find. Widgets mark their outer area out of date whenever they are moved,
+ *  resized, enabled, disabled or destroyed; only those rectangles are
+ *  repainted, from the head down, skipping subtrees that do not overlap, on
+ *  the next hit-test. Safe to call from any thread. */
+class Hit_map {
+   public:
+    /// Returns the Widget owning global cell (x, y), nullptr if none.
+    static Widget* widget_at(std::size_t x, std::size_t y);
+
+    /// Marks the outer area of \p w as out of date.
+    /** Called before and after the geometry of \p w changes. */
+    static void invalidate(const Widget& w);
+
+    /// Marks the entire map as out of date.
+    static void invalidate_all();
+
+    /// Releases the index of \p w, called as \p w is destroyed.
+    static void forget(const Widget& w);
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_SYSTEM_DETAIL_HIT_MAP_HPP
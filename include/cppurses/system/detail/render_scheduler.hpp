@@ -0,0 +1,128 @@
+#ifndef CPPURSES_SYSTEM_DETAIL_RENDER_SCHEDULER_HPP
+#define CPPURSES_SYSTEM_DETAIL_RENDER_SCHEDULER_HPP
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+namespace cppurses {
+namespace detail {
+
+/// Decides when an Event_loop flushes its staged changes to the screen.
+/** Paint Events are held on the Event_queue, where duplicates are coalesced,
+ *  until a frame is due. A frame is due once the frame budget has passed since
+ *  the previous frame, or at the next iteration if requested, as is done after
+ *  user input. A deferred frame is flushed on a later iteration of the loop,
+ *  timer loops iterate at least once per period. */
+class Render_scheduler {
+   public:
+    using Clock_t = std::chrono::steady_clock;
+    using Period_t = std::chrono::milliseconds;
+
+    /// Counters describing the work done by a single Event_loop.
+    struct Stats {
+        /// Number of frames flushed to the screen.
+        std::size_t frames{0};
+
+        /// Number of iterations that left Events pending for a later frame.
+        std::size_t deferred_frames{0};
+
+        /// Number of Paint_events dropped as duplicates of one already queued.
+        std::size_t coalesced_paints{0};
+
+        /// Number of Events sent by the Event_loop.
+        std::size_t events_dispatched{0};
+
+        /// Number of cells output to the terminal.
+        std::size_t cells_emitted{0};
+
+        /// Number of bytes written, see output::bytes_written().
+        std::size_t bytes_written{0};
+    };
+
+    /// A single flushed frame.
+    struct Frame_record {
+        /// When the frame was flushed, default constructed if never recorded.
+        Clock_t::time_point end;
+
+        /// Time spent invoking Paint_events and flushing the frame.
+        std::chrono::microseconds duration{0};
+
+        std::size_t cells{0};
+        std::size_t bytes{0};
+    };
+
+    /// Number of frames kept by recent_frames(), a second at 60 frames/sec.
+    static constexpr std::size_t frame_history_size{64};
+
+    using Frame_history = std::array<Frame_record, frame_history_size>;
+
+    /// Returns true if a frame should be flushed on this iteration.
+    bool frame_due() const {
+        return immediate_ || Clock_t::now() - last_frame_ >= frame_budget();
+    }
+
+    /// Makes the next call to frame_due() return true.
+    void request_immediate_frame() { immediate_ = true; }
+
+    /// Records that a frame has been flushed.
+    /** \p duration is the time taken to paint and flush, \p cells and \p bytes
+     *  are what was written to the terminal. */
+    void frame_flushed(std::chrono::microseconds duration,
+                       std::size_t cells,
+                       std::size_t bytes) {
+        last_frame_ = Clock_t::now();
+        immediate_ = false;
+        ++stats_.frames;
+        stats_.cells_emitted += cells;
+        stats_.bytes_written += bytes;
+        recent_frames_[next_record_] =
+            Frame_record{last_frame_, duration, cells, bytes};
+        next_record_ = (next_record_ + 1) % frame_history_size;
+    }
+
+    /// Records that pending Events have been left for a later frame.
+    void frame_deferred() { ++stats_.deferred_frames; }
+
+    /// Returns the time left until a frame is due, zero if it is due.
+    /** Rounded up to the next whole Period_t. */
+    Period_t time_until_due() const {
+        if (immediate_) {
+            return Period_t::zero();
+        }
+        const auto left = last_frame_ + frame_budget() - Clock_t::now();
+        if (left <= Clock_t::duration::zero()) {
+            return Period_t::zero();
+        }
+        return std::chrono::duration_cast<Period_t>(left) + Period_t{1};
+    }
+
+    /// Returns the counters for the owning Event_loop.
+    const Stats& stats() const { return stats_; }
+
+    /// Returns the most recent frames, in no particular order.
+    /** A fixed size ring buffer, entries with a default constructed end time
+     *  have not been recorded yet. */
+    const Frame_history& recent_frames() const { return recent_frames_; }
+
+    /// Sets the minimum time between two frames of the same Event_loop.
+    /** Defaults to 16ms, roughly 60 frames per second. Zero flushes every
+     *  iteration. */
+    static void set_frame_budget(Period_t budget) { frame_budget_ = budget; }
+
+    /// Returns the minimum time between two frames of the same Event_loop.
+    static Period_t frame_budget() { return frame_budget_; }
+
+   private:
+    Clock_t::time_point last_frame_;
+    bool immediate_{true};
+    Stats stats_;
+    Frame_history recent_frames_;
+    std::size_t next_record_{0};
+
+    static std::atomic<Period_t> frame_budget_;
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_SYSTEM_DETAIL_RENDER_SCHEDULER_HPP
@@ -1,11 +1,16 @@
 #ifndef CPPURSES_SYSTEM_DETAIL_TIMER_EVENT_LOOP_HPP
 #define CPPURSES_SYSTEM_DETAIL_TIMER_EVENT_LOOP_HPP
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <functional>
-#include <set>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <unordered_map>
+#include <vector>
 
 #include <signals/connection.hpp>
-#include <signals/signal.hpp>
 
 #include <cppurses/system/event_loop.hpp>
 
@@ -13,52 +18,88 @@ namespace cppurses {
 class Widget;
 namespace detail {
 
-/// Implements an Event_loop associated with a particular Period_t.
-/** Sends Timer_events every period from its own thread. */
+/// Keeps time for every animated Widget on a single thread.
+/** Deadlines are held in a min-heap, the thread sleeps until the earliest one.
+ *  Each Widget has a constant or a variable period, the next deadline is the
+ *  previous deadline plus the period, so time spent posting does not cause
+ *  drift; deadlines missed by a whole period are skipped instead of fired in a
+ *  burst. Every Timer_event due at the same time is posted to the main
+ *  Event_loop as a single batch. Registration can be changed from any
+ *  thread. */
 class Timer_event_loop : public Event_loop {
    public:
     using Period_t = std::chrono::milliseconds;
 
-    /// Create a Timer Loop with a constant period.
-    explicit Timer_event_loop(Period_t period)
-        : period_func_{[period] { return period; }} {}
-
-    /// Create a Timer_loop with a variable period.
-    explicit Timer_event_loop(std::function<Period_t()> period_func)
-        : period_func_{period_func} {}
-
+    Timer_event_loop() = default;
     Timer_event_loop(Timer_event_loop&&) = default;
     Timer_event_loop& operator=(Timer_event_loop&&) = default;
 
-    /// Register a widget to have a Timer_event posted to it every period.
-    /** No-op if widget is already registered. */
-    void register_widget(Widget& w);
-
-    /// Stop a widget from recieving Timer_events for this loop.
-    bool unregister_widget(Widget& w) {
-        return registered_widgets_.erase(&w) == 1;
+    /// Exits the loop while the members used by loop_function() are alive.
+    ~Timer_event_loop() override {
+        this->exit(0);
+        this->wait();
     }
 
-    /// Sets a new constant period for the Timer loop.
-    void set_period(Period_t period) {
-        period_func_ = [period] { return period; };
+    /// Post a Timer_event to \p w every \p period.
+    /** Replaces any previous registration of \p w, the first Timer_event is
+     *  posted one period from now. */
+    void register_widget(Widget& w, Period_t period) {
+        this->register_widget(w, [period] { return period; });
     }
 
-    /// Sets a new variable period for the Timer loop.
-    void set_period(const std::function<Period_t()>& period_function) {
-        period_func_ = period_function;
-    }
+    /// Post a Timer_event to \p w every \p period_func().
+    /** \p period_func is called on the timer thread after each Timer_event,
+     *  for the time until the next one. Replaces any previous registration of
+     *  \p w. */
+    void register_widget(Widget& w, std::function<Period_t()> period_func);
+
+    /// Stop a widget from recieving Timer_events for this loop.
+    bool unregister_widget(Widget& w);
 
     /// Returns true if no Widgets are registered with this event loop.
-    bool empty() const { return registered_widgets_.empty(); }
+    bool empty() const;
 
    protected:
+    /// Posts the Timer_events that are due, then sleeps until the next one.
+    /** The sleep is cut short by wake_up(). */
     void loop_function() override;
 
+    void wake_up() override;
+
    private:
-    std::set<Widget*> registered_widgets_;
-    std::function<Period_t()> period_func_;
-    std::chrono::time_point<std::chrono::high_resolution_clock> last_time_;
+    using Clock_t = std::chrono::steady_clock;
+
+    struct Registration {
+        std::uint64_t id;
+        std::function<Period_t()> period_func;
+        sig::Connection on_destroyed;
+    };
+
+    /// A deadline in the heap, stale once its Registration id is replaced.
+    struct Deadline {
+        Clock_t::time_point when;
+        Widget* widget;
+        std::uint64_t id;
+
+        /// Orders the heap with the earliest deadline on top.
+        bool operator<(const Deadline& other) const {
+            return when > other.when;
+        }
+    };
+
+    /// State shared with the loop's thread, guarded by mtx.
+    /** Held by a shared_ptr so Widget::destroyed connections can check that it
+     *  is still alive. */
+    struct Shared_state {
+        std::mutex mtx;
+        std::condition_variable woken_cv;
+        bool woken{false};
+        std::uint64_t next_id{0};
+        std::unordered_map<Widget*, Registration> registrations;
+        std::priority_queue<Deadline> deadlines;
+    };
+
+    std::shared_ptr<Shared_state> state_{std::make_shared<Shared_state>()};
 };
 
 }  // namespace detail
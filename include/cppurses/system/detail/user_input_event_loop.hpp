@@ -1,16 +1,25 @@
 #ifndef CPPURSES_SYSTEM_DETAIL_USER_INPUT_EVENT_LOOP_HPP
 #define CPPURSES_SYSTEM_DETAIL_USER_INPUT_EVENT_LOOP_HPP
 #include <cppurses/system/event_loop.hpp>
+#include <cppurses/terminal/detail/input_reactor.hpp>
 
 namespace cppurses {
 namespace detail {
 
 /// Event loop that blocks for user input on each iteration.
-/** Uses ncurses internally to get input. */
+/** Input, terminal resizes and Events posted from other threads are all
+ *  waited on by a single Input_reactor, ncurses is not used for input. */
 class User_input_event_loop : public Event_loop {
    protected:
-    /// Waits on input::get(), and posts the result.
+    /// Waits on the Input_reactor, and posts the Events it returns.
+    /** Requests an immediate frame for input, bypassing the frame budget. The
+     *  wait ends when a deferred frame is due. */
     void loop_function() override;
+
+    void wake_up() override;
+
+   private:
+    Input_reactor reactor_;
 };
 
 }  // namespace detail
@@ -1,8 +1,16 @@
 #ifndef CPPURSES_SYSTEM_EVENT_HPP
 #define CPPURSES_SYSTEM_EVENT_HPP
+#include <chrono>
+#include <cstddef>
+
+#include <cppurses/system/detail/event_pool.hpp>
 
 namespace cppurses {
 class Widget;
+namespace detail {
+class Event_mailbox;
+class Event_queue;
+}  // namespace detail
 
 /// Base class for types passed around by the Event system.
 /** Events encapsulate a behavior to apply to a Widget. Events are created and
@@ -46,12 +54,29 @@ class Event {
     Event& operator=(Event&&) = delete;
     virtual ~Event() = default;
 
+    /// Allocates from the detail::Event_pool of the calling thread.
+    static void* operator new(std::size_t size) {
+        return detail::Event_pool::allocate(size);
+    }
+
+    /// Returns the memory of an Event to the detail::Event_pool.
+    /** \p size is the size of the derived type, the destructor is virtual. */
+    static void operator delete(void* block, std::size_t size) noexcept {
+        detail::Event_pool::deallocate(block, size);
+    }
+
     /// Return a Type enum describing the derived type of the Event.
     Type type() const { return type_; }
 
     /// Return a pointer to the Widget that will receiver the Event.
     Widget& receiver() const { return receiver_; }
 
+    /// Returns the time the Event was appended to an Event_queue.
+    /** Only set while the Tracer is enabled, default constructed otherwise. */
+    std::chrono::steady_clock::time_point queued_time() const {
+        return queued_time_;
+    }
+
     /// Calls filter_send() on each installed event filter object in receiver_.
     /** Event filters can be set up with Widget::install_event_filter(). Filters
      *  are used to intercept Events on other Widgets. The first filter to
@@ -79,6 +104,15 @@ class Event {
    protected:
     Type type_;
     Widget& receiver_;
+
+   private:
+    std::chrono::steady_clock::time_point queued_time_;
+
+    /// The next Event in a detail::Event_mailbox, nullptr when not in one.
+    Event* mailbox_next_{nullptr};
+
+    friend class detail::Event_mailbox;
+    friend class detail::Event_queue;
 };
 
 }  // namespace cppurses
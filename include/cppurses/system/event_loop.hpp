@@ -1,18 +1,32 @@
 #ifndef CPPURSES_SYSTEM_EVENT_LOOP_HPP
 #define CPPURSES_SYSTEM_EVENT_LOOP_HPP
 #include <atomic>
+#include <chrono>
 #include <future>
+#include <memory>
 #include <thread>
+#include <vector>
 
 #include <cppurses/painter/detail/screen.hpp>
 #include <cppurses/painter/detail/staged_changes.hpp>
 #include <cppurses/system/detail/event_invoker.hpp>
+#include <cppurses/system/detail/event_mailbox.hpp>
+#include <cppurses/system/detail/event_pool.hpp>
 #include <cppurses/system/detail/event_queue.hpp>
+#include <cppurses/system/detail/render_scheduler.hpp>
 
 namespace cppurses {
-
-/// Processes the Event_queue and flushes changes to the Terminal at each iter.
-/** Specialized by providing a loop_function to be run at each iteration. */
+class Event;
+class Widget;
+
+/// Processes the Event_queue and flushes changes to the Terminal.
+/** Specialized by providing a loop_function to be run at each iteration. Paint
+ *  and Delete Events are only processed when a frame is flushed, which happens
+ *  at most once per frame budget, see detail::Render_scheduler. Only the main
+ *  loop paints and touches the Terminal, other loops pass their Paint Events on
+ *  to it and process Delete Events right away. Events for a Widget should all
+ *  be processed by one loop, the main loop, other threads post to it with
+ *  post_event(). */
 class Event_loop {
    public:
     Event_loop() = default;
@@ -38,10 +52,26 @@ class Event_loop {
 
     /// Calls on the loop to exit at the next exit point.
     /** The return code value is used when returning from run() or wait(). This
-     *  function is thread safe. */
+     *  function is thread safe, the loop is woken up if it is waiting. */
     virtual void exit(int return_code) {
         return_code_ = return_code;
         exit_ = true;
+        this->wake_up();
+    }
+
+    /// Posts \p event to this loop, can be called from any thread.
+    /** Lock-free. The Event is appended to the Event_queue at the start of the
+     *  next iteration of the loop, the loop is woken up if it is waiting. */
+    void post_event(std::unique_ptr<Event> event) {
+        mailbox_.push(std::move(event));
+        this->wake_up();
+    }
+
+    /// Posts each of \p events to this loop, can be called from any thread.
+    /** As post_event(), with a single wake up for the whole batch. */
+    void post_events(std::vector<std::unique_ptr<Event>> events) {
+        mailbox_.push_all(std::move(events));
+        this->wake_up();
     }
 
     /// Blocks until the async event loop returns.
@@ -61,18 +91,54 @@ class Event_loop {
     /// Returns the Staged_changes of this loop/thread.
     detail::Staged_changes& staged_changes() { return staged_changes_; }
 
+    /// Returns frame and Paint_event counters for this loop.
+    /** Not synchronized, should be called from this loop's thread. */
+    detail::Render_scheduler::Stats render_stats() const;
+
+    /// Returns the most recently flushed frames of this loop.
+    /** Not synchronized, should be called from this loop's thread. */
+    const detail::Render_scheduler::Frame_history& recent_frames() const {
+        return scheduler_.recent_frames();
+    }
+
+    /// Returns the Event allocation counters of this loop's thread.
+    /** Only valid when called from this loop's thread. */
+    detail::Event_pool::Stats event_pool_stats() const {
+        return detail::Event_pool::stats();
+    }
+
    protected:
     /// Override this in derived classes to define Event_loop behavior.
     /** This function will be called on once every loop iteration. It is
      *  expected that is will post an event to the Event_queue. After this
      *  function is called, the Event_queue is invoked, and then staged changes
-     *  for this Event_loop are flushed to the screen, and the loop begins
-     *  again. */
+     *  of the main Event_loop are flushed to the screen if a frame is due, and
+     *  the loop begins again. */
     virtual void loop_function() = 0;
 
+    /// Flush a frame on the next iteration, regardless of the frame budget.
+    void request_immediate_frame() { scheduler_.request_immediate_frame(); }
+
+    /// Interrupts any wait in loop_function(), so the loop iterates again.
+    /** Called from any thread after an Event is posted with post_event(), or
+     *  on exit. Must be thread safe. The default does nothing, for loops that
+     *  do not wait long. */
+    virtual void wake_up() {}
+
+    /// Returns the longest loop_function() can wait without delaying a frame.
+    /** Negative if no Events are pending, so the next frame is not needed
+     *  until something is posted. */
+    std::chrono::milliseconds pending_frame_timeout() const {
+        return event_queue_.empty() ? std::chrono::milliseconds{-1}
+                                    : scheduler_.time_until_due();
+    }
+
    private:
     void process_events();
 
+    /// Removes all queued Events with \p receiver, from this loop's thread.
+    void discard_events(const Widget& receiver);
+
     std::future<int> fut_;
     std::thread::id thread_id_;
     int return_code_{0};
@@ -80,7 +146,9 @@ class Event_loop {
     bool running_{false};
 
     detail::Event_queue event_queue_;
+    detail::Event_mailbox mailbox_;
     detail::Event_invoker invoker_;
+    detail::Render_scheduler scheduler_;
 
     detail::Staged_changes staged_changes_;
     detail::Screen screen_;
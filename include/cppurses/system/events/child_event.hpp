@@ -1,6 +1,5 @@
 #ifndef CPPURSES_SYSTEM_EVENTS_CHILD_EVENT_HPP
 #define CPPURSES_SYSTEM_EVENTS_CHILD_EVENT_HPP
-#include <cppurses/painter/detail/screen_state.hpp>
 #include <cppurses/system/event.hpp>
 #include <cppurses/widget/widget.hpp>
 
@@ -13,11 +12,6 @@ class Child_event : public Event {
     Child_event(Event::Type type, Widget& receiver, Widget& child)
         : Event{type, receiver}, child_{child} {}
 
-    bool send() const override {
-        receiver_.screen_state().optimize.child_event = true;
-        return true;
-    }
-
    protected:
     Widget& child_;
 };
@@ -29,7 +23,6 @@ class Child_added_event : public Child_event {
         : Child_event{Event::ChildAdded, receiver, child} {}
 
     bool send() const override {
-        Child_event::send();
         return receiver_.child_added_event(child_);
     }
 
@@ -45,7 +38,6 @@ class Child_removed_event : public Child_event {
         : Child_event{Event::ChildRemoved, receiver, child} {}
 
     bool send() const override {
-        Child_event::send();
         return receiver_.child_removed_event(child_);
     }
 
@@ -61,7 +53,6 @@ class Child_polished_event : public Child_event {
         : Child_event{Event::ChildPolished, receiver, child} {}
 
     bool send() const override {
-        Child_event::send();
         return receiver_.child_polished_event(child_);
     }
 
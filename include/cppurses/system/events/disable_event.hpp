@@ -1,7 +1,5 @@
 #ifndef CPPURSES_SYSTEM_EVENTS_DISABLE_EVENT_HPP
 #define CPPURSES_SYSTEM_EVENTS_DISABLE_EVENT_HPP
-#include <cppurses/painter/detail/screen_descriptor.hpp>
-#include <cppurses/painter/detail/screen_state.hpp>
 #include <cppurses/system/event.hpp>
 #include <cppurses/widget/widget.hpp>
 
@@ -16,7 +14,6 @@ class Disable_event : public Event {
         : Event{Event::Disable, receiver} {}
 
     bool send() const override {
-        receiver_.screen_state().tiles.clear();
         return receiver_.disable_event();
     }
 
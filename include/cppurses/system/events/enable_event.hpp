@@ -1,6 +1,5 @@
 #ifndef CPPURSES_SYSTEM_EVENTS_ENABLE_EVENT_HPP
 #define CPPURSES_SYSTEM_EVENTS_ENABLE_EVENT_HPP
-#include <cppurses/painter/detail/screen_state.hpp>
 #include <cppurses/system/event.hpp>
 #include <cppurses/widget/widget.hpp>
 
@@ -13,7 +12,6 @@ class Enable_event : public Event {
     explicit Enable_event(Widget& receiver) : Event{Event::Enable, receiver} {}
 
     bool send() const override {
-        receiver_.screen_state().optimize.just_enabled = true;
         return receiver_.enable_event();
     }
 
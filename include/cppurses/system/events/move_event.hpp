@@ -22,6 +22,10 @@ class Move_event : public Event {
    protected:
     Point new_position_;
     mutable Point old_position_;
+
+   private:
+    /// Gives the receiver a scroll hint if it has moved vertically only.
+    void hint_vertical_move() const;
 };
 
 }  // namespace cppurses
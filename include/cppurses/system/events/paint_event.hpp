@@ -12,8 +12,13 @@ class Paint_event : public Event {
     explicit Paint_event(Widget& receiver) : Event{Event::Paint, receiver} {}
 
     bool send() const override {
-        return !detail::is_paintable(receiver_) ? false
-                                                : receiver_.paint_event();
+        if (!detail::is_paintable(receiver_)) {
+            return false;
+        }
+        if (receiver_.paint_cache_.enabled()) {
+            return receiver_.paint_cache_.paint(receiver_);
+        }
+        return receiver_.paint_event();
     }
     bool filter_send(Widget& filter) const override {
         return filter.paint_event_filter(receiver_);
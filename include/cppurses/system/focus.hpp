@@ -22,8 +22,42 @@ class Focus {
 
     static void clear_focus();
 
+    /// Links \p w into, or unlinks it from, the Tab focus chain.
+    /** The chain holds, in tree order, each enabled descendant of
+     *  System::head() with a Tab or Strong Focus_policy, so finding the next
+     *  and previous Tab focus is O(1). Called when the Focus_policy, enabled
+     *  state or parent of \p w changes. Linking costs the distance in the
+     *  tree to the previous Widget in the chain. */
+    static void update_chain(Widget& w);
+
+    /// Calls update_chain() on \p w and each of its descendants, in order.
+    static void update_chain_tree(Widget& w);
+
+    /// Removes \p w from the chain, called as \p w is destroyed.
+    static void unlink(Widget& w);
+
+    /// Rebuilds the chain from System::head().
+    static void reset_chain();
+
    private:
     static Widget* focus_widget_;
+
+    /// First Widget of the circular chain, in tree order, nullptr if empty.
+    static Widget* chain_first_;
+
+    static bool is_linked(const Widget& w);
+
+    static void link_after(Widget& w, Widget* previous);
+
+    /// Returns the closest Widget in the chain before \p w in tree order.
+    static Widget* previous_linked(const Widget& w);
+
+    /// Returns the last Widget in the chain from the subtree of \p root.
+    static Widget* last_linked_in(Widget& root);
+
+    static Widget* next_tab_focus();
+
+    static Widget* previous_tab_focus();
 };
 
 }  // namespace cppurses
@@ -1,5 +1,6 @@
 #ifndef CPPURSES_SYSTEM_SYSTEM_HPP
 #define CPPURSES_SYSTEM_SYSTEM_HPP
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -7,6 +8,7 @@
 
 #include <signals/slot.hpp>
 
+#include <cppurses/system/detail/render_scheduler.hpp>
 #include <cppurses/system/detail/user_input_event_loop.hpp>
 #include <cppurses/terminal/terminal.hpp>
 
@@ -47,9 +49,16 @@ class System {
     /// Appends the event to the Event_queue for the thread it was called on.
     /** The Event_queue is processed once per iteration of the Event_loop. When
      *  the Event is pulled from the Event_queue, it is processed by
-     *  System::send_event() */
+     *  System::send_event(). If no Event_loop is running on the calling thread,
+     *  the Event is posted to the main Event_loop, as by the overload taking an
+     *  Event_loop. */
     static void post_event(std::unique_ptr<Event> event);
 
+    /// Posts \p event to \p loop, can be called from any thread.
+    /** Lock-free, see Event_loop::post_event(). Used by worker threads to hand
+     *  results to the user interface, usually through main_event_loop(). */
+    static void post_event(Event_loop& loop, std::unique_ptr<Event> event);
+
     /// Appends a newly created Event of type T onto the Event_queue.
     /** \p args... are passed onto the constructor of T. Has same behavior as
      *  the non-templated function of the same name once the object has been
@@ -60,16 +69,30 @@ class System {
         System::post_event(std::move(event));
     }
 
+    /// Posts a newly created Event of type T to \p loop, from any thread.
+    /** \p args... are passed onto the constructor of T. */
+    template <typename T, typename... Args>
+    static void post_event_to(Event_loop& loop, Args&&... args) {
+        auto event = std::make_unique<T>(std::forward<Args>(args)...);
+        System::post_event(loop, std::move(event));
+    }
+
+    /// Returns the Event_loop that processes user input, run by System::run().
+    static Event_loop& main_event_loop();
+
     /// Returns the Event_loop associated with the calling thread.
     /** Each currently running Event_loop has to be run on its own thread, this
      *  function will find and return the Event_loop that is currently running
      *  on the calling thread. Used by Painter to get the staged_changes owned
-     *  by Event_loop. */
+     *  by Event_loop. Returns the main Event_loop if the calling thread is not
+     *  running an Event_loop. Lock-free, the Event_loop of each thread is
+     *  recorded in a thread local variable by register_event_loop(). */
     static Event_loop& find_event_loop();
 
     /// Adds an Event_loop* to a list of currently running Event_loops.
     /** Used by Event_loop::run() to automatically register itself to the list
-     *  of running Event_loops when the loop begins. */
+     *  of running Event_loops when the loop begins. Must be called from the
+     *  thread that runs \p loop. */
     static void register_event_loop(Event_loop* loop);
 
     /// Removes the given Event_loop* from list of running Event_loops.
@@ -78,6 +101,12 @@ class System {
      * is not registered. */
     static void deregister_event_loop(Event_loop* loop);
 
+    /// Removes queued Events with \p receiver from the calling thread's loop.
+    /** Used by the Widget destructor, so no Event outlives its receiver. Events
+     *  posted to the loop from other threads are included. No-op if the
+     *  calling thread is not running an Event_loop. */
+    static void discard_events(const Widget& receiver);
+
     /// Sends an exit signal to each of the currently running Event_loops.
     /** Also calls shutdown() on the Animation_engine and sets
      *  System::exit_requested_ to true. Though it sends the exit signal to each
@@ -89,6 +118,19 @@ class System {
     /** This manages animation on each of the Widgets that enables it. */
     static Animation_engine& animation_engine() { return animation_engine_; }
 
+    /// Sets the minimum time between two frames flushed by an Event_loop.
+    /** Paint_events posted within this time are coalesced into one frame.
+     *  Frames caused by user input are not delayed. Zero flushes on every
+     *  Event_loop iteration. Defaults to 16ms. */
+    static void set_frame_budget(std::chrono::milliseconds budget) {
+        detail::Render_scheduler::set_frame_budget(budget);
+    }
+
+    /// Returns the minimum time between two frames flushed by an Event_loop.
+    static std::chrono::milliseconds frame_budget() {
+        return detail::Render_scheduler::frame_budget();
+    }
+
     /// Returns whether System has gotten an exit request, set by System::exit()
     static bool exit_requested() { return exit_requested_; }
 
@@ -0,0 +1,174 @@
+#ifndef CPPURSES_SYSTEM_TRACER_HPP
+#define CPPURSES_SYSTEM_TRACER_HPP
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <cppurses/system/event.hpp>
+
+namespace cppurses {
+class Widget;
+
+/// Times Event dispatch and frame output, to find what eats the frame budget.
+/** Disabled by default, when disabled each Event costs a single relaxed atomic
+ *  load. When enabled, the queue wait and handler time of every Event are
+ *  recorded per Event::Type and per receiving Widget and Event::Type, and the
+ *  paint and flush time of every frame are recorded. Durations are counted in
+ *  fixed bucket Histograms. Each thread records into its own lock-free
+ *  counters. A thread only takes a lock the first time it records an
+ *  Event::Type for a Widget, readers take that lock while reading per Widget
+ *  counts. Optionally each Event and frame phase is also kept as a span for a
+ *  Chrome trace-event JSON file. */
+class Tracer {
+   public:
+    using Clock_t = std::chrono::steady_clock;
+
+    /// What is timed for each Event.
+    enum class Metric {
+        Queue_wait,  // From entering the Event_queue until being sent.
+        Handler      // Sending the Event, the paint time of Paint_events.
+    };
+
+    /// What is timed once per frame.
+    enum class Phase {
+        Paint,  // Invoking all Paint_events of the frame.
+        Flush   // Writing the frame to the terminal.
+    };
+
+    /// Counts of durations in power of two microsecond buckets.
+    struct Histogram {
+        static constexpr std::size_t bucket_count{24};
+
+        /// Bucket 0 counts durations under 1us, bucket i counts durations in
+        /// [2^(i-1), 2^i)us, and the last bucket counts everything longer.
+        std::array<std::uint64_t, bucket_count> buckets{};
+        std::uint64_t total_us{0};
+        std::uint64_t max_us{0};
+
+        /// Returns the number of durations recorded.
+        std::uint64_t count() const;
+
+        /// Returns the mean duration in microseconds, zero if empty.
+        double mean_us() const;
+
+        /// Returns an upper bound in microseconds of the \p p quantile.
+        /** \p p is in [0, 1], 0.99 gives the 99th percentile. Returns the
+         *  upper edge of the bucket holding the quantile, clamped to max_us. */
+        std::uint64_t percentile_us(double p) const;
+
+        /// Adds each of the counts of \p other to this Histogram.
+        Histogram& operator+=(const Histogram& other);
+
+        /// Returns the index of the bucket that counts \p us microseconds.
+        static std::size_t bucket_for(std::uint64_t us);
+    };
+
+    /// Starts or stops recording, can be called from any thread.
+    static void enable(bool enable = true);
+
+    /// Stops recording, recorded counts are kept.
+    static void disable() { Tracer::enable(false); }
+
+    /// Returns true if Events and frames are being recorded.
+    static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    /// Sets every count back to zero, drops the per Widget counts and names,
+    /// and drops recorded trace spans.
+    static void reset();
+
+    /// Drops the counts of \p w, called by the Widget destructor.
+    /** A Widget later created at the same address starts with no counts. */
+    static void forget(const Widget& w);
+
+    /// Returns the counts of every thread for Events of \p type.
+    static Histogram event_histogram(Event::Type type, Metric metric);
+
+    /// Returns the counts of every thread for Events of any type sent to \p w.
+    static Histogram widget_histogram(const Widget& w, Metric metric);
+
+    /// Returns the counts of every thread for Events of \p type sent to \p w.
+    /** With Event::Paint and Metric::Handler, this is the paint time of \p w.
+     */
+    static Histogram widget_histogram(const Widget& w,
+                                      Event::Type type,
+                                      Metric metric);
+
+    /// Returns the counts of every thread for \p phase of each frame.
+    static Histogram frame_histogram(Phase phase);
+
+    /// The total handler and paint time of a single Widget.
+    struct Widget_cost {
+        /// Identifies the Widget, might have been destroyed since.
+        const Widget* widget;
+        std::string name;
+        /// Time spent handling Events of every type, Paint_events included.
+        std::uint64_t handler_us;
+        /// Time spent handling Paint_events.
+        std::uint64_t paint_us;
+    };
+
+    /// Returns the total handler and paint time of each recorded Widget.
+    /** Summed across threads, in no particular order. */
+    static std::vector<Widget_cost> widget_costs();
+
+    /// Writes a table of every non-empty Histogram to \p os.
+    /** Lists count, mean, 50th, 99th percentile and max per Event::Type, per
+     *  Widget and Event::Type, with Widgets sorted by total handler time, and
+     *  per frame Phase. */
+    static void dump(std::ostream& os);
+
+    /// Also keep each Event and frame Phase as a span, while enabled().
+    /** At most a fixed number of spans are kept per thread, later spans are
+     *  dropped until write_chrome_trace() or reset() is called. */
+    static void enable_chrome_trace(bool enable = true);
+
+    /// Writes the recorded spans as Chrome trace-event JSON, then drops them.
+    /** The output can be loaded by chrome://tracing or Perfetto. */
+    static void write_chrome_trace(std::ostream& os);
+
+    /// Times sending one Event, construct just before the Event is sent.
+    /** Does nothing unless enabled() when constructed. The receiver must be
+     *  alive on construction, it does not need to be on destruction. */
+    class Event_scope {
+       public:
+        explicit Event_scope(const Event& event);
+        Event_scope(const Event_scope&) = delete;
+        Event_scope& operator=(const Event_scope&) = delete;
+        ~Event_scope();
+
+       private:
+        bool active_;
+        Event::Type type_;
+        Clock_t::time_point queued_;
+        Clock_t::time_point start_;
+        const Widget* receiver_{nullptr};
+        std::uint64_t serial_{0};
+    };
+
+    /// Times one Phase of a frame, for the lifetime of the Frame_scope.
+    /** Does nothing unless enabled() when constructed. */
+    class Frame_scope {
+       public:
+        explicit Frame_scope(Phase phase);
+        Frame_scope(const Frame_scope&) = delete;
+        Frame_scope& operator=(const Frame_scope&) = delete;
+        ~Frame_scope();
+
+       private:
+        bool active_;
+        Phase phase_;
+        Clock_t::time_point start_;
+    };
+
+   private:
+    static std::atomic<bool> enabled_;
+    static std::atomic<bool> chrome_trace_;
+};
+
+}  // namespace cppurses
+#endif  // CPPURSES_SYSTEM_TRACER_HPP
@@ -0,0 +1,69 @@
+#ifndef CPPURSES_TERMINAL_DETAIL_ESCAPE_OUTPUT_HPP
+#define CPPURSES_TERMINAL_DETAIL_ESCAPE_OUTPUT_HPP
+#include <cstddef>
+#include <string>
+
+#include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/glyph.hpp>
+
+namespace cppurses {
+namespace detail {
+
+/// Builds a frame of VT escape sequences in a single buffer.
+/** Cursor moves and color/attribute changes are only written when they differ
+ *  from the current terminal state. The buffer is written to stdout with one
+ *  write(2) call when the frame is flushed. */
+class Escape_output {
+   public:
+    /// Preallocates the frame buffer.
+    Escape_output();
+
+    /// Writes \p count Glyphs sharing a Brush in a row, starting at \p x, \p y.
+    void put(std::size_t x,
+             std::size_t y,
+             const Glyph* glyphs,
+             std::size_t count);
+
+    /// Moves the rows [\p top, \p bottom) up by \p lines, negative is down.
+    void scroll_rows(std::size_t top, std::size_t bottom, std::ptrdiff_t lines);
+
+    /// Ends the next flushed frame with a visible cursor at \p x, \p y.
+    void show_cursor_at(std::size_t x, std::size_t y);
+
+    /// Writes the frame to the terminal and starts a new frame.
+    /** No-op if nothing has been put and no cursor position set since the last
+     *  flush. The cursor is left where show_cursor_at() asked for, otherwise
+     *  it is returned to where ncurses last left it. */
+    void flush();
+
+    /// Returns the number of bytes written to the terminal by flush() so far.
+    std::size_t bytes_written() const { return bytes_written_; }
+
+   private:
+    std::string buffer_;
+    std::size_t bytes_written_{0};
+    Brush brush_;
+    bool brush_known_{false};
+    std::size_t cursor_x_{0};
+    std::size_t cursor_y_{0};
+    bool cursor_known_{false};
+    std::size_t shown_cursor_x_{0};
+    std::size_t shown_cursor_y_{0};
+    bool shows_cursor_{false};
+
+    /// Appends a cursor position sequence, unless already at \p x, \p y.
+    void move_cursor(std::size_t x, std::size_t y);
+
+    /// Appends a select graphic rendition sequence, unless \p b is current.
+    void set_brush(const Brush& b);
+
+    /// Appends the UTF-8 encoding of \p symbol.
+    void append_symbol(wchar_t symbol);
+
+    /// Appends the decimal representation of \p value.
+    void append_number(std::size_t value);
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_TERMINAL_DETAIL_ESCAPE_OUTPUT_HPP
@@ -0,0 +1,79 @@
+#ifndef CPPURSES_TERMINAL_DETAIL_INPUT_DECODER_HPP
+#define CPPURSES_TERMINAL_DETAIL_INPUT_DECODER_HPP
+#include <cstddef>
+#include <string>
+
+#include <cppurses/system/key.hpp>
+#include <cppurses/system/mouse_button.hpp>
+
+namespace cppurses {
+namespace detail {
+
+/// A single key press or mouse button event read from the terminal.
+struct Decoded_input {
+    enum class Kind { Key, Mouse_press, Mouse_release };
+
+    Kind kind;
+    Key key;
+    Mouse_button button;
+
+    /// Screen coordinates of a mouse event, top left is (x:0, y:0).
+    std::size_t x;
+    std::size_t y;
+};
+
+/// Decodes the bytes read from the terminal into keys and mouse events.
+/** Understands UTF-8 and ASCII bytes, which are passed through one byte at a
+ *  time, CSI and SS3 key sequences as sent by xterm compatible terminals, and
+ *  SGR (1006) and X10 (1000) mouse reports. Key values are the same as ncurses
+ *  gives for each key. Sequences can be split across reads; an incomplete
+ *  sequence is held until more bytes arrive or flush() is called. */
+class Input_decoder {
+   public:
+    /// Appends \p count bytes to the input still to be decoded.
+    void feed(const char* bytes, std::size_t count);
+
+    /// Decodes the next key or mouse event into \p input.
+    /** Returns false if there is nothing left, or only the start of a
+     *  sequence that needs more bytes to be decoded. Unrecognized sequences
+     *  are skipped. */
+    bool next(Decoded_input& input);
+
+    /// Returns true if an incomplete sequence is waiting for more bytes.
+    bool pending() const { return read_pos_ < buffer_.size(); }
+
+    /// Decode pending input without waiting for the rest of a sequence.
+    /** Used once no more bytes arrive in time, a lone escape byte is then the
+     *  Escape key, not the start of a sequence. */
+    void flush() { flushing_ = true; }
+
+   private:
+    std::string buffer_;
+    std::size_t read_pos_{0};
+    bool flushing_{false};
+    Mouse_button last_pressed_{Mouse_button::None};
+
+    /// Result of decoding at read_pos_, consumed is zero if incomplete.
+    struct Step {
+        std::size_t consumed;
+        bool produced;
+    };
+
+    Step decode(Decoded_input& input);
+    Step decode_csi(Decoded_input& input);
+    Step decode_ss3(Decoded_input& input);
+    Step decode_x10_mouse(Decoded_input& input);
+
+    /// Fills \p input from a mouse report, returns false if not a button.
+    /** \p code holds the button and flag bits common to SGR and X10 reports,
+     *  \p x and \p y are zero based. */
+    bool decode_mouse(int code,
+                      int x,
+                      int y,
+                      bool release,
+                      Decoded_input& input);
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_TERMINAL_DETAIL_INPUT_DECODER_HPP
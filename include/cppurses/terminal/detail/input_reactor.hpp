@@ -0,0 +1,58 @@
+#ifndef CPPURSES_TERMINAL_DETAIL_INPUT_REACTOR_HPP
+#define CPPURSES_TERMINAL_DETAIL_INPUT_REACTOR_HPP
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <cppurses/terminal/detail/input_decoder.hpp>
+
+namespace cppurses {
+class Event;
+namespace detail {
+
+/// Waits on terminal input, terminal resizes and wake ups with one epoll_wait.
+/** stdin is read directly and decoded by an Input_decoder, SIGWINCH is read
+ *  from a signalfd and wake ups from other threads come through an eventfd.
+ *  Nothing here calls into ncurses, so input never touches ncurses' state. */
+class Input_reactor {
+   public:
+    /// Opens the epoll instance, the signalfd and the eventfd.
+    /** SIGWINCH is blocked for the calling thread so it can be read from the
+     *  signalfd, threads started afterwards inherit the blocked signal. Throws
+     *  std::runtime_error if the epoll instance can't be created. */
+    Input_reactor();
+
+    Input_reactor(const Input_reactor&) = delete;
+    Input_reactor& operator=(const Input_reactor&) = delete;
+
+    /// Closes each file descriptor.
+    ~Input_reactor();
+
+    /// Waits for input, a terminal resize, or wake_up().
+    /** Returns an Event for each key press, mouse button and resize received,
+     *  possibly none. Gives up after \p timeout if it is not negative. */
+    std::vector<std::unique_ptr<Event>> wait(std::chrono::milliseconds timeout);
+
+    /// Ends the current or next call to wait(), can be called from any thread.
+    void wake_up();
+
+   private:
+    using Clock_t = std::chrono::steady_clock;
+
+    int epoll_fd_{-1};
+    int signal_fd_{-1};
+    int wake_fd_{-1};
+    Input_decoder decoder_;
+    Clock_t::time_point last_read_;
+
+    /// Reads what is available on stdin into the decoder.
+    void read_input();
+
+    /// Empties \p fd of its \p size byte records, a signalfd or an eventfd.
+    static void drain(int fd, std::size_t size);
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_TERMINAL_DETAIL_INPUT_REACTOR_HPP
@@ -14,6 +14,15 @@ void move_cursor(std::size_t x, std::size_t y);
 /// Flushes all of the changes made since the last refresh to the screen.
 void refresh();
 
+/// Leaves the cursor at the point \p x , \p y on screen after the next refresh.
+/** Call after the Glyphs of a frame have been put, putting moves the cursor.
+ *  Does not change the visibility of the cursor, see Terminal::show_cursor. */
+void show_cursor_at(std::size_t x, std::size_t y);
+
+/// Returns the number of bytes written to the terminal by refresh() so far.
+/** Only counts escape sequence output, ncurses does its own writes. */
+std::size_t bytes_written();
+
 /// Places Glyph \p g on the screen at the current cursor position.
 void put(const Glyph& g);
 
@@ -25,6 +34,16 @@ inline void put(std::size_t x, std::size_t y, const Glyph& g) {
     put(g);
 }
 
+/// Places \p count Glyphs from \p glyphs in a row, starting at \p x , \p y.
+/** All Glyphs must have the same Brush, so the run can be output with a single
+ *  cursor move and a single write to the screen. */
+void put(std::size_t x, std::size_t y, const Glyph* glyphs, std::size_t count);
+
+/// Moves the rows [\p top, \p bottom) of the screen up by \p lines.
+/** Negative \p lines moves the rows down. Uses the terminal's scrolling region,
+ *  rows moved into the range are blank. */
+void scroll_rows(std::size_t top, std::size_t bottom, std::ptrdiff_t lines);
+
 }  // namespace output
 }  // namespace cppurses
 #endif  // CPPURSES_TERMINAL_OUTPUT_HPP
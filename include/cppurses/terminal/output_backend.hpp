@@ -0,0 +1,18 @@
+#ifndef CPPURSES_TERMINAL_OUTPUT_BACKEND_HPP
+#define CPPURSES_TERMINAL_OUTPUT_BACKEND_HPP
+
+namespace cppurses {
+
+/// Selects how painted Glyphs are written to the terminal.
+enum class Output_backend {
+    /// Glyphs are written to ncurses' stdscr, which is diffed on refresh.
+    Ncurses,
+
+    /// Glyphs are written as VT escape sequences, one write(2) per frame.
+    /** Frames are wrapped in synchronized update markers, so terminals that
+     *  support them render each frame atomically. */
+    Escape_sequence
+};
+
+}  // namespace cppurses
+#endif  // CPPURSES_TERMINAL_OUTPUT_BACKEND_HPP
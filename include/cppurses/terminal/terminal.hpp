@@ -5,6 +5,7 @@
 #include <cppurses/painter/glyph.hpp>
 #include <cppurses/painter/palette.hpp>
 #include <cppurses/painter/palettes.hpp>
+#include <cppurses/terminal/output_backend.hpp>
 
 namespace cppurses {
 
@@ -20,6 +21,14 @@ class Terminal {
     /** No-op if already uninitialized. */
     void uninitialize();
 
+    /// Sets how painted Glyphs are written to the terminal.
+    /** Must be called before initialize(), no-op if already initialized. The
+     *  default is Output_backend::Ncurses. Input is always read via ncurses. */
+    void set_output_backend(Output_backend backend);
+
+    /// Returns the Output_backend in use, or to be used by initialize().
+    Output_backend output_backend() const { return output_backend_; }
+
     /// Returns the width of the terminal screen.
     std::size_t width() const;
 
@@ -67,9 +76,7 @@ class Terminal {
     Glyph background_{L' '};
     Palette palette_{Palettes::DawnBringer()};
     bool raw_mode_{false};
-
-    /// Registers the input::indicate_resize signal handler for sigwinch signal.
-    void setup_resize_signal_handler() const;
+    Output_backend output_backend_{Output_backend::Ncurses};
 
     /// Actually sets the palette via ncurses using the state of palette_.
     void ncurses_set_palette() const;
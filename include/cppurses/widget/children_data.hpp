@@ -30,6 +30,7 @@ class Children_data {
     bool has(const std::string& name) const;
 
     /// Checks if the owning Widget recursively owns \p descendant.
+    /** Walks up the parent chain of \p descendant, O(depth). */
     bool has_descendant(Widget* descendant) const;
 
     /// Checks if the owning Widget has the descendent with \p name.
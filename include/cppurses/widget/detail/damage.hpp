@@ -0,0 +1,54 @@
+#ifndef CPPURSES_WIDGET_DETAIL_DAMAGE_HPP
+#define CPPURSES_WIDGET_DETAIL_DAMAGE_HPP
+#include <cstddef>
+#include <vector>
+
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/rect.hpp>
+
+namespace cppurses {
+namespace detail {
+
+/// Accumulates the regions of a Widget that need to be repainted.
+/** Regions are in Widget local coordinates. Overlapping or adjacent regions
+ *  are merged into their bounding rectangle, and once max_rects would be
+ *  exceeded, a new region is merged with the existing region that grows the
+ *  least. Damage with nothing recorded covers the entire Widget, so that a
+ *  Paint_event without a region repaints everything. */
+class Damage {
+   public:
+    /// The largest number of separate rectangles kept.
+    static constexpr std::size_t max_rects{4};
+
+    /// Add \p region to the damaged regions, no-op if it has no area.
+    void add(const Rect& region);
+
+    /// Mark the entire Widget as damaged.
+    void add_all() {
+        all_ = true;
+        rects_.clear();
+    }
+
+    /// Returns true if the entire Widget is damaged.
+    bool is_all() const { return all_ || rects_.empty(); }
+
+    /// Returns the separate damaged regions, empty if is_all() is true.
+    const std::vector<Rect>& rects() const { return rects_; }
+
+    /// Returns true if \p p, in local coordinates, is damaged.
+    bool contains(const Point& p) const;
+
+    /// Remove all damage, called once the Widget has been repainted.
+    void clear() {
+        all_ = false;
+        rects_.clear();
+    }
+
+   private:
+    bool all_{false};
+    std::vector<Rect> rects_;
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_DETAIL_DAMAGE_HPP
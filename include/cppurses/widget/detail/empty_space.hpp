@@ -0,0 +1,66 @@
+#ifndef CPPURSES_WIDGET_DETAIL_EMPTY_SPACE_HPP
+#define CPPURSES_WIDGET_DETAIL_EMPTY_SPACE_HPP
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <cppurses/widget/rect.hpp>
+
+namespace cppurses {
+class Widget;
+namespace detail {
+
+/// The parts of a Widget's inner area that no enabled child covers.
+/** Kept as a sorted list of gaps per row, found with a sweep over the outer
+ *  areas of the children. Cached until the inner area of the Widget or the
+ *  outer area of one of its enabled children changes. Used to find where a
+ *  Layout should paint wallpaper, one run per gap. */
+class Empty_space {
+   public:
+    /// Recalculates the gaps if the geometry of \p w or its children changed.
+    void update(const Widget& w);
+
+    /// Calls \p f(y, x_begin, x_end) for each gap, clipped to \p region.
+    /** \p region and the [x_begin, x_end) gaps are in global coordinates. */
+    template <typename Function>
+    void for_each_gap(const Rect& region, Function&& f) const {
+        const auto top = std::max(region.top_left.y, inner_.top_left.y);
+        const auto bottom =
+            std::min(region.top_left.y + region.area.height,
+                     inner_.top_left.y + inner_.area.height);
+        const auto left = region.top_left.x;
+        const auto right = region.top_left.x + region.area.width;
+        for (auto y = top; y < bottom; ++y) {
+            const auto row = y - inner_.top_left.y;
+            for (auto i = row_starts_[row]; i < row_starts_[row + 1]; ++i) {
+                const auto begin = std::max(gaps_[i].begin, left);
+                const auto end = std::min(gaps_[i].end, right);
+                if (begin < end) {
+                    f(y, begin, end);
+                }
+            }
+        }
+    }
+
+   private:
+    struct Gap {
+        std::size_t begin;
+        std::size_t end;
+    };
+
+    bool valid_{false};
+    Rect inner_{};
+    std::vector<Rect> children_;  // Enabled children, clipped to inner_.
+    std::vector<Gap> gaps_;
+    std::vector<std::size_t> row_starts_;  // Row r is [starts[r], starts[r+1])
+
+    /// Returns true if the cached geometry still matches \p w.
+    bool is_current(const Widget& w, const Rect& inner) const;
+
+    /// Finds the gaps of each row of inner_ not covered by children_.
+    void sweep();
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_DETAIL_EMPTY_SPACE_HPP
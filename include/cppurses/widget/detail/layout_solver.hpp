@@ -0,0 +1,392 @@
+#ifndef CPPURSES_WIDGET_DETAIL_LAYOUT_SOLVER_HPP
+#define CPPURSES_WIDGET_DETAIL_LAYOUT_SOLVER_HPP
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <cppurses/widget/size_policy.hpp>
+
+namespace cppurses {
+namespace detail {
+
+/// Grows or shrinks the lengths of a row of Widgets along one axis of a Layout.
+/** Axis is a traits class for the element type being sized:
+ *      static const Size_policy& policy(const Element&);
+ *      static std::size_t& length(Element&);
+ *  The policy only needs type(), stretch(), min() and max(). Elements are
+ *  given as random access iterators.
+ *
+ *  Extra space is shared by stretch factor, first among Expanding and
+ *  MinimumExpanding elements, then what they could not take among Preferred,
+ *  Minimum and Ignored elements; space left over from rounding is handed out
+ *  one cell at a time in the same order. Missing space is taken in
+ *  inverse proportion to stretch factor, first from Maximum, Preferred and
+ *  Ignored elements, then from Expanding elements, never below min().
+ *
+ *  An element that would pass its max() or min() is clamped there and takes
+ *  no further part. Clamping an element of the second group starts sharing
+ *  over from the first group, with what is left. Shares are rounded down with
+ *  the same floating point expressions the Layouts have always used, so sizes
+ *  are unchanged. A stretch factor of zero takes no share.
+ *
+ *  Candidates are sorted once by the share at which they would be clamped, so
+ *  a group is resolved in O(n log n), followed by a linear pass that settles
+ *  rounding ties in element order. Scratch space is kept between calls, there
+ *  is no heap allocation once it has grown to the row length. */
+template <typename Axis>
+class Layout_solver {
+   public:
+    /// Grows elements in [first, last) to use \p space extra cells.
+    /** Returns the number of cells that could not be used. */
+    template <typename Iter>
+    std::size_t distribute(Iter first, Iter last, std::size_t space) {
+        active_.assign(static_cast<std::size_t>(last - first), true);
+        for (;;) {
+            space = this->resolve<Grow>(first, last, space, &is_expanding);
+            if (space == 0) {
+                return 0;
+            }
+            if (!this->has_active(first, last, &is_expanding)) {
+                space = this->resolve<Grow>(first, last, space, &is_flexible);
+                break;
+            }
+            if (!this->settle<Grow>(first, last, space, &is_flexible, true)) {
+                break;
+            }
+        }
+        space = this->round_robin(first, last, space, &is_expanding);
+        return this->round_robin(first, last, space, &is_flexible);
+    }
+
+    /// Shrinks elements in [first, last) to give back \p space cells.
+    /** Returns the number of cells that could not be given back. */
+    template <typename Iter>
+    std::size_t collect(Iter first, Iter last, std::size_t space) {
+        active_.assign(static_cast<std::size_t>(last - first), true);
+        for (;;) {
+            space = this->resolve<Shrink>(first, last, space, &is_shrinkable);
+            if (space == 0) {
+                return 0;
+            }
+            if (!this->has_active(first, last, &is_shrinkable)) {
+                return this->resolve<Shrink>(first, last, space,
+                                             &is_expanding_only);
+            }
+            if (!this->settle<Shrink>(first, last, space, &is_expanding_only,
+                                      true)) {
+                return space;
+            }
+        }
+    }
+
+   private:
+    using Group = bool (*)(Size_policy::Type);
+
+    struct Candidate {
+        std::size_t index;
+        std::size_t stretch;
+        double threshold;  // The share at which this element is clamped.
+    };
+
+    std::vector<Candidate> candidates_;
+    std::vector<double> totals_;
+    std::vector<std::size_t> shares_;
+    std::vector<bool> active_;  // False once an element has been clamped.
+
+    /// Growing towards max(), shares are in proportion to stretch factor.
+    struct Grow {
+        template <typename Policy>
+        static bool is_past(std::size_t length, const Policy& p) {
+            return length > p.max();
+        }
+
+        /// Cells until max(), wraps around if past it.
+        template <typename Policy>
+        static std::size_t room(std::size_t length, const Policy& p) {
+            return p.max() - length;
+        }
+
+        template <typename Policy>
+        static std::size_t bound(const Policy& p) { return p.max(); }
+
+        static void apply(std::size_t& length, std::size_t share) {
+            length += share;
+        }
+
+        static double weight(std::size_t stretch) { return stretch; }
+
+        /// Once space / total weight reaches this, the element is clamped.
+        static double threshold(std::size_t room, std::size_t stretch) {
+            return (static_cast<double>(room) + 1) / stretch;
+        }
+
+        /// Whether the share is over \p room, taken while sorting candidates.
+        /** Stretch totals are whole numbers, so this is exact. */
+        static bool is_over(std::size_t stretch,
+                            double total,
+                            std::size_t space,
+                            std::size_t room) {
+            return share(stretch, total, space) > room;
+        }
+
+        static std::size_t share(std::size_t stretch,
+                                 double total_stretch,
+                                 std::size_t space) {
+            return static_cast<std::size_t>((stretch / total_stretch) *
+                                            static_cast<double>(space));
+        }
+
+        /// The share of each active element in \p group, in element order.
+        template <typename Iter>
+        static void shares(Iter first,
+                           const std::vector<bool>& active,
+                           Group group,
+                           std::size_t space,
+                           std::vector<std::size_t>& out) {
+            auto total = std::size_t{0};
+            for (auto i = std::size_t{0}; i < out.size(); ++i) {
+                if (active[i] && group(Axis::policy(first[i]).type())) {
+                    total += Axis::policy(first[i]).stretch();
+                }
+            }
+            for (auto i = std::size_t{0}; i < out.size(); ++i) {
+                out[i] = 0;
+                if (active[i] && group(Axis::policy(first[i]).type()) &&
+                    total != 0) {
+                    out[i] = share(Axis::policy(first[i]).stretch(),
+                                   static_cast<double>(total), space);
+                }
+            }
+        }
+    };
+
+    /// Shrinking towards min(), shares are inverse to stretch factor.
+    struct Shrink {
+        template <typename Policy>
+        static bool is_past(std::size_t length, const Policy& p) {
+            return length < p.min();
+        }
+
+        /// Cells until min(), wraps around if past it.
+        template <typename Policy>
+        static std::size_t room(std::size_t length, const Policy& p) {
+            return length - p.min();
+        }
+
+        template <typename Policy>
+        static std::size_t bound(const Policy& p) { return p.min(); }
+
+        static void apply(std::size_t& length, std::size_t share) {
+            length -= share;
+        }
+
+        static double weight(std::size_t stretch) { return 1.0 / stretch; }
+
+        /// Once space / total weight reaches this, the element is clamped.
+        static double threshold(std::size_t room, std::size_t stretch) {
+            return (static_cast<double>(room) + 1) * stretch;
+        }
+
+        /// Whether the share is clearly over \p room.
+        /** The total weight is summed in sorted order here, rather than in
+         *  element order, so shares that land on a whole number are left to
+         *  the exact pass. */
+        static bool is_over(std::size_t stretch,
+                            double total,
+                            std::size_t space,
+                            std::size_t room) {
+            const auto margin = 1e-9;
+            return space / (stretch * total) >=
+                   (static_cast<double>(room) + 1) * (1 + margin);
+        }
+
+        /// The share of each active element in \p group, in element order.
+        template <typename Iter>
+        static void shares(Iter first,
+                           const std::vector<bool>& active,
+                           Group group,
+                           std::size_t space,
+                           std::vector<std::size_t>& out) {
+            const auto takes_part = [&](std::size_t i) {
+                const auto& policy = Axis::policy(first[i]);
+                return active[i] && group(policy.type()) &&
+                       policy.stretch() != 0;
+            };
+            auto total = std::size_t{0};
+            for (auto i = std::size_t{0}; i < out.size(); ++i) {
+                if (takes_part(i)) {
+                    total += Axis::policy(first[i]).stretch();
+                }
+            }
+            auto total_inverse = 0.0;
+            for (auto i = std::size_t{0}; i < out.size(); ++i) {
+                if (takes_part(i)) {
+                    total_inverse += 1 / (Axis::policy(first[i]).stretch() /
+                                          static_cast<double>(total));
+                }
+            }
+            for (auto i = std::size_t{0}; i < out.size(); ++i) {
+                out[i] = 0;
+                if (takes_part(i)) {
+                    const auto inverse = 1 / (Axis::policy(first[i]).stretch() /
+                                              static_cast<double>(total));
+                    out[i] = static_cast<std::size_t>(
+                        (inverse / total_inverse) * static_cast<double>(space));
+                }
+            }
+        }
+    };
+
+    static bool is_expanding(Size_policy::Type t) {
+        return t == Size_policy::Expanding ||
+               t == Size_policy::MinimumExpanding;
+    }
+
+    static bool is_flexible(Size_policy::Type t) {
+        return t == Size_policy::Preferred || t == Size_policy::Minimum ||
+               t == Size_policy::Ignored;
+    }
+
+    static bool is_shrinkable(Size_policy::Type t) {
+        return t == Size_policy::Maximum || t == Size_policy::Preferred ||
+               t == Size_policy::Ignored;
+    }
+
+    static bool is_expanding_only(Size_policy::Type t) {
+        return t == Size_policy::Expanding;
+    }
+
+    template <typename Iter>
+    bool has_active(Iter first, Iter last, Group group) const {
+        for (auto i = std::size_t{0}; first + i != last; ++i) {
+            if (active_[i] && group(Axis::policy(first[i]).type())) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Sets element \p i to its bound and takes it out of sharing.
+    template <typename Direction, typename Iter>
+    void clamp(Iter first, std::size_t i, std::size_t& space) {
+        const auto& policy = Axis::policy(first[i]);
+        auto& length = Axis::length(first[i]);
+        // Unsigned wrap around gives space back for an element past its bound.
+        space -= Direction::room(length, policy);
+        length = Direction::bound(policy);
+        active_[i] = false;
+    }
+
+    /// Shares \p space within \p group, clamping elements at their bound.
+    /** Returns what is left over from rounding. */
+    template <typename Direction, typename Iter>
+    std::size_t resolve(Iter first, Iter last, std::size_t space, Group group) {
+        candidates_.clear();
+        for (auto i = std::size_t{0}; first + i != last; ++i) {
+            const auto& policy = Axis::policy(first[i]);
+            if (!active_[i] || !group(policy.type()) || policy.stretch() == 0) {
+                continue;
+            }
+            const auto length = Axis::length(first[i]);
+            const auto threshold =
+                Direction::is_past(length, policy)
+                    ? -1.0
+                    : Direction::threshold(Direction::room(length, policy),
+                                           policy.stretch());
+            candidates_.push_back(Candidate{i, policy.stretch(), threshold});
+        }
+        std::sort(std::begin(candidates_), std::end(candidates_),
+                  [](const Candidate& a, const Candidate& b) {
+                      return a.threshold < b.threshold;
+                  });
+        // totals_[i] is the weight of candidates i and after.
+        totals_.assign(candidates_.size() + 1, 0.0);
+        for (auto i = candidates_.size(); i > 0; --i) {
+            totals_[i - 1] =
+                totals_[i] + Direction::weight(candidates_[i - 1].stretch);
+        }
+        for (auto next = std::size_t{0}; next < candidates_.size(); ++next) {
+            const Candidate& c = candidates_[next];
+            const auto& policy = Axis::policy(first[c.index]);
+            const auto length = Axis::length(first[c.index]);
+            if (!Direction::is_past(length, policy) &&
+                !Direction::is_over(c.stretch, totals_[next], space,
+                                    Direction::room(length, policy))) {
+                break;
+            }
+            this->clamp<Direction>(first, c.index, space);
+        }
+        while (this->settle<Direction>(first, last, space, group, false)) {
+        }
+        return space;
+    }
+
+    /// Computes the share of each active element of \p group in element
+    /// order, as the Layouts always have, and clamps any that pass their bound.
+    /** Clamps only the first such element if \p first_only is true. Returns
+     *  true if an element was clamped, otherwise applies the shares and
+     *  returns false. */
+    template <typename Direction, typename Iter>
+    bool settle(Iter first,
+                Iter last,
+                std::size_t& space,
+                Group group,
+                bool first_only) {
+        const auto size = static_cast<std::size_t>(last - first);
+        shares_.resize(size);
+        Direction::shares(first, active_, group, space, shares_);
+        auto clamped = false;
+        for (auto i = std::size_t{0}; i < size; ++i) {
+            const auto& policy = Axis::policy(first[i]);
+            if (!active_[i] || !group(policy.type())) {
+                continue;
+            }
+            const auto length = Axis::length(first[i]);
+            if (Direction::is_past(length, policy) ||
+                shares_[i] > Direction::room(length, policy)) {
+                this->clamp<Direction>(first, i, space);
+                clamped = true;
+                if (first_only) {
+                    return true;
+                }
+            }
+        }
+        if (clamped) {
+            return true;
+        }
+        for (auto i = std::size_t{0}; i < size; ++i) {
+            Direction::apply(Axis::length(first[i]), shares_[i]);
+            space -= shares_[i];
+        }
+        return false;
+    }
+
+    /// Hands out \p space one cell per element per pass, in element order.
+    template <typename Iter>
+    std::size_t round_robin(Iter first,
+                            Iter last,
+                            std::size_t space,
+                            Group group) {
+        auto handed_out = true;
+        while (space > 0 && handed_out) {
+            handed_out = false;
+            for (auto i = std::size_t{0}; first + i != last && space > 0;
+                 ++i) {
+                const auto& policy = Axis::policy(first[i]);
+                auto& length = Axis::length(first[i]);
+                if (active_[i] && group(policy.type()) &&
+                    length < policy.max()) {
+                    ++length;
+                    --space;
+                    handed_out = true;
+                }
+            }
+        }
+        return space;
+    }
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_DETAIL_LAYOUT_SOLVER_HPP
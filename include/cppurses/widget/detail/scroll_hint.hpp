@@ -0,0 +1,65 @@
+#ifndef CPPURSES_WIDGET_DETAIL_SCROLL_HINT_HPP
+#define CPPURSES_WIDGET_DETAIL_SCROLL_HINT_HPP
+#include <cstddef>
+
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/rect.hpp>
+
+namespace cppurses {
+namespace detail {
+
+/// Records that a band of the screen has moved vertically since the last paint.
+/** The band is in global coordinates. A positive number of lines moves the
+ *  contents up, towards the top of the screen. Hints for the same band are
+ *  added together, a hint for a different band makes the hint unusable until
+ *  cleared. Screen uses the hint to shift what is already on the terminal
+ *  instead of rewriting every cell in the band. */
+class Scroll_hint {
+   public:
+    /// Record that the contents of \p band moved up by \p lines.
+    void add(const Rect& band, std::ptrdiff_t lines) {
+        if (conflicted_) {
+            return;
+        }
+        if (lines_ == 0) {
+            band_ = band;
+            lines_ = lines;
+        } else if (is_same_band(band)) {
+            lines_ += lines;
+        } else {
+            conflicted_ = true;
+            lines_ = 0;
+        }
+    }
+
+    /// Returns true if there is no usable hint.
+    bool empty() const { return conflicted_ || lines_ == 0; }
+
+    /// Returns the band of the screen that has moved.
+    const Rect& band() const { return band_; }
+
+    /// Returns the number of lines the band has moved up, negative is down.
+    std::ptrdiff_t lines() const { return lines_; }
+
+    /// Remove the hint, called once the Widget has been painted.
+    void clear() {
+        lines_ = 0;
+        conflicted_ = false;
+    }
+
+   private:
+    Rect band_{Point{0, 0}, Area{0, 0}};
+    std::ptrdiff_t lines_{0};
+    bool conflicted_{false};
+
+    bool is_same_band(const Rect& band) const {
+        return band.top_left == band_.top_left &&
+               band.area.width == band_.area.width &&
+               band.area.height == band_.area.height;
+    }
+};
+
+}  // namespace detail
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_DETAIL_SCROLL_HINT_HPP
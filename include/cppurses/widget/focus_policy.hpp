@@ -2,6 +2,7 @@
 #define CPPURSES_WIDGET_FOCUS_POLICY_HPP
 
 namespace cppurses {
+class Widget;
 
 /// Defines different ways a Widget can receiver the focus of the system.
 /** None: Widget cannot have focus. */
@@ -10,5 +11,28 @@ namespace cppurses {
 /** Strong: Both Tab and Click policies apply. */
 enum class Focus_policy { None, Tab, Click, Strong };
 
+/// Holds the Focus_policy of a Widget, telling Focus when it changes.
+/** Assigned from and converts to Focus_policy, so it is used as one. */
+class Focus_policy_data {
+   public:
+    explicit Focus_policy_data(Widget* owner) : owner_{owner} {}
+
+    Focus_policy_data(const Focus_policy_data&) = default;
+
+    /// Sets the policy, the owner joins or leaves the Tab focus chain.
+    Focus_policy_data& operator=(Focus_policy policy);
+
+    /// Copies only the policy of \p other, not its owner.
+    Focus_policy_data& operator=(const Focus_policy_data& other) {
+        return *this = other.policy_;
+    }
+
+    operator Focus_policy() const { return policy_; }
+
+   private:
+    Widget* owner_;
+    Focus_policy policy_{Focus_policy::None};
+};
+
 }  // namespace cppurses
 #endif  // CPPURSES_WIDGET_FOCUS_POLICY_HPP
@@ -1,51 +1,58 @@
 #ifndef CPPURSES_WIDGET_LAYOUT_HPP
 #define CPPURSES_WIDGET_LAYOUT_HPP
 #include <cstddef>
+#include <unordered_map>
 
 #include <cppurses/painter/color.hpp>
+#include <cppurses/widget/area.hpp>
 #include <cppurses/widget/point.hpp>
 #include <cppurses/widget/widget.hpp>
 
 namespace cppurses {
-struct Area;
-struct Point;
-
 /// Provided as a uniform interface for arranging child Widgets.
 /** The update_geometry() function will be called each time there is a reason to
  *  believe that the children Widgets of this Widget will want to change
- *  position and size. */
+ *  position and size. Layouts are updated incrementally, child sizes are only
+ *  recalculated when marked dirty, by a child being added, removed or
+ *  polished, or by this Layout being resized or re-enabled. A clean Layout
+ *  that is moved only moves its children. Move and Resize events are only
+ *  posted to children whose position or size has changed. */
 class Layout : public Widget {
+   public:
+    /// Marks the Layout dirty when it is re-enabled, children were disabled.
+    void enable(bool enable = true,
+                bool post_child_polished_event = true) override;
+
    protected:
     /// Clients override this to post Resize and Move events to children.
-    /** This will be called each time the children Widgets possibly need to be
-     *  rearranged. Triggered by Move_event, Resize_event, Child_added_event,
-     *  Child_removed_event, and Child_polished_event. */
+    /** This will be called each time the children Widgets need to be
+     *  rearranged, after the Layout has been marked dirty. Triggered by
+     *  Move_event, Resize_event, Child_added_event, Child_removed_event, and
+     *  Child_polished_event. Children should be positioned with place_child()
+     *  and disabled with disable_child(). */
     virtual void update_geometry() = 0;
 
-    bool move_event(Point new_position, Point old_position) override {
-        this->update_geometry();
-        return Widget::move_event(new_position, old_position);
-    }
+    bool move_event(Point new_position, Point old_position) override;
+    bool resize_event(Area new_size, Area old_size) override;
+    bool child_added_event(Widget& child) override;
+    bool child_removed_event(Widget& child) override;
+    bool child_polished_event(Widget& child) override;
 
-    bool resize_event(Area new_size, Area old_size) override {
-        this->update_geometry();
-        return Widget::resize_event(new_size, old_size);
-    }
+    /// Marks the sizes of the children as needing to be recalculated.
+    void invalidate_geometry() { geometry_dirty_ = true; }
 
-    bool child_added_event(Widget& child) override {
-        this->update_geometry();
-        return Widget::child_added_event(child);
-    }
+    /// Enables this Layout and each disabled child, to take part in sizing.
+    /** Enabled children are left alone, so their subtrees are not touched. */
+    void enable_children();
 
-    bool child_removed_event(Widget& child) override {
-        this->update_geometry();
-        return Widget::child_removed_event(child);
-    }
+    /// Posts a Move_event and a Resize_event to \p child, if it would change.
+    /** Compared against the last geometry given to \p child by this Layout. */
+    void place_child(Widget& child, Point position, Area size);
 
-    bool child_polished_event(Widget& child) override {
-        this->update_geometry();
-        return Widget::child_polished_event(child);
-    }
+    /// Disables \p child without posting a Child_polished_event to this Layout.
+    /** Used for children that do not fit, the next place_child() call on
+     *  \p child posts both events. */
+    void disable_child(Widget& child);
 
     struct Dimensions {
         Widget* widget;
@@ -53,11 +60,18 @@ class Layout : public Widget {
         std::size_t height;
     };
 
-    struct Dimensions_reference {
-        Widget* widget;
-        std::size_t* width;
-        std::size_t* height;
+   private:
+    /// The last position and size given to a child by place_child().
+    struct Child_geometry {
+        Point position;
+        Area size;
     };
+
+    std::unordered_map<const Widget*, Child_geometry> placed_;
+    bool geometry_dirty_{true};
+
+    /// Calls update_geometry() if dirty.
+    void refresh_geometry();
 };
 
 // Free Functions
@@ -3,7 +3,9 @@
 #include <cstddef>
 #include <vector>
 
+#include <cppurses/widget/detail/layout_solver.hpp>
 #include <cppurses/widget/layout.hpp>
+#include <cppurses/widget/size_policy.hpp>
 
 namespace cppurses {
 class Widget;
@@ -16,11 +18,15 @@ class Vertical_layout : public Layout {
     std::vector<Dimensions> calculate_widget_sizes();
     void move_and_resize_children(const std::vector<Dimensions>& dimensions);
 
-    void distribute_space(std::vector<Dimensions_reference> widgets,
-                          int height_left);
+    /// Sizes the children along the vertical axis.
+    struct Height {
+        static const Size_policy& policy(const Dimensions& d) {
+            return d.widget->height_policy;
+        }
+        static std::size_t& length(Dimensions& d) { return d.height; }
+    };
 
-    void collect_space(std::vector<Dimensions_reference> widgets,
-                       int height_left);
+    detail::Layout_solver<Height> solver_;
 };
 
 }  // namespace cppurses
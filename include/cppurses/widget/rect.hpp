@@ -0,0 +1,17 @@
+#ifndef CPPURSES_WIDGET_RECT_HPP
+#define CPPURSES_WIDGET_RECT_HPP
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/point.hpp>
+
+namespace cppurses {
+
+/// Represents a rectangle by its top left Point and its Area.
+/** Usually taken to be relative to the top-left corner of a Widget's inner
+ *  area, or of the Terminal screen. */
+struct Rect {
+    Point top_left;
+    Area area;
+};
+
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_RECT_HPP
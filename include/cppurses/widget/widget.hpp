@@ -14,7 +14,7 @@
 #include <cppurses/painter/attribute.hpp>
 #include <cppurses/painter/brush.hpp>
 #include <cppurses/painter/color.hpp>
-#include <cppurses/painter/detail/screen_state.hpp>
+#include <cppurses/painter/detail/paint_cache.hpp>
 #include <cppurses/painter/glyph.hpp>
 #include <cppurses/system/animation_engine.hpp>
 #include <cppurses/system/key.hpp>
@@ -24,12 +24,21 @@
 #include <cppurses/widget/children_data.hpp>
 #include <cppurses/widget/cursor_data.hpp>
 #include <cppurses/widget/detail/border_offset.hpp>
+#include <cppurses/widget/detail/damage.hpp>
+#include <cppurses/widget/detail/empty_space.hpp>
+#include <cppurses/widget/detail/scroll_hint.hpp>
 #include <cppurses/widget/focus_policy.hpp>
 #include <cppurses/widget/point.hpp>
+#include <cppurses/widget/rect.hpp>
 #include <cppurses/widget/size_policy.hpp>
 
 namespace cppurses {
 struct Area;
+namespace detail {
+class Screen;
+}  // namespace detail
+class Focus;
+class Paint_event;
 
 class Widget {
    public:
@@ -163,9 +172,50 @@ class Widget {
 
     /// Posts a paint event to itself.
     /** Useful to prompt an update of the Widget when the state of the Widget
-     *  has changed. */
+     *  has changed. The entire Widget is repainted. */
     virtual void update();
 
+    /// Posts a paint event to itself, only \p region needs to be repainted.
+    /** \p region is in local coordinates. Regions accumulate until the next
+     *  paint_event(), only points within them are taken from the staged
+     *  changes, the rest of the screen is left as is. No-op if \p region has
+     *  no area. */
+    void update(const Rect& region);
+
+    /// Hints that the contents of the inner area moved up by \p lines.
+    /** Negative \p lines moves the contents down. Does not post a paint event,
+     *  the Widget still has to be updated. Lets the screen shift what is
+     *  already displayed instead of rewriting it, used when scrolling. */
+    void hint_scroll(std::ptrdiff_t lines) {
+        scroll_hint_.add(
+            Rect{Point{this->inner_x(), this->inner_y()},
+                 Area{this->width(), this->height()}},
+            lines);
+    }
+
+    /// Returns the regions to be repainted by the next paint_event().
+    /** paint_event() implementations can use this to skip painting points
+     *  that have not changed, painting them anyway is not an error. */
+    const detail::Damage& damage() const { return damage_; }
+
+    /// Reuse the output of the last paint_event() while it would not change.
+    /** When enabled, a Paint_event does not call paint_event() unless
+     *  content_changed() has been called, or the position, size, brush or
+     *  Border::enabled has changed since the last call. For Widgets with
+     *  mostly static output, such as labels and borders. */
+    void enable_paint_cache(bool enable = true) {
+        paint_cache_.enable(enable);
+    }
+
+    /// Returns true if the output of paint_event() is cached.
+    bool paint_cache_enabled() const { return paint_cache_.enabled(); }
+
+    /// Marks the output of paint_event() as changed for the paint cache.
+    /** Must be called when anything paint_event() draws from is modified,
+     *  other than the position, size, brush and Border::enabled. Does not post
+     *  a paint event. */
+    void content_changed() { paint_cache_.content_changed(); }
+
     /// Install another Widget as an Event filter.
     /** The installed Widget will get the first go at processing the event with
      *  its filter event handler function. Widgets are installed in the order
@@ -187,9 +237,9 @@ class Widget {
     /** Animated widgets receiver a Timer_event every \p period. This Timer
      *  Event should be used to update the state of the Widget. The animation
      *  system will also post a paint event to this Widget so the Widget can
-     *  update itself. This is all handled on a separate thread from the main
-     *  user input thread, and therefore has its own staged_changes object that
-     *  it paints to to avoid shared data issues. */
+     *  update itself. The timing is kept on a separate thread, which posts the
+     *  Timer_events to the main Event_loop, so they are processed on the same
+     *  thread as user input. */
     void enable_animation(Animation_engine::Period_t period);
 
     /// Enables variable animation on this Widget.
@@ -220,7 +270,7 @@ class Widget {
     Size_policy height_policy{this};
 
     /// Describes how focus is given to this Widget.
-    Focus_policy focus_policy{Focus_policy::None};
+    Focus_policy_data focus_policy{this};
 
     /// Used to fill in empty space that is not filled in by paint_event().
     opt::Optional<Glyph> wallpaper;
@@ -242,12 +292,6 @@ class Widget {
      *  to true. */
     Glyph generate_wallpaper() const;
 
-    /// Returns the current Screen_state of this Widget, as it appears.
-    detail::Screen_state& screen_state() { return screen_state_; }
-
-    /// Returns the current Screen_state of this Widget, as it appears.
-    const detail::Screen_state& screen_state() const { return screen_state_; }
-
     // Signals
     sig::Signal<void(const std::string&)> name_changed;
     sig::Signal<void(std::size_t, std::size_t)> resized;
@@ -273,6 +317,9 @@ class Widget {
 
     friend class Resize_event;
     friend class Move_event;
+    friend class detail::Screen;
+    friend class Paint_event;
+    friend class Focus;
 
     // - - - - - - - - - - - - - Event Handlers - - - - - - - - - - - - - - - -
     /// Handles Enable_event objects.
@@ -415,9 +462,16 @@ class Widget {
     Widget* parent_{nullptr};
     bool enabled_{false};
     bool brush_paints_wallpaper_{true};
-    detail::Screen_state screen_state_;
+    detail::Damage damage_;
+    detail::Scroll_hint scroll_hint_;
+    detail::Empty_space empty_space_;
+    detail::Paint_cache paint_cache_;
     std::vector<Widget*> event_filters_;
 
+    // Neighbours in the circular Tab focus chain, nullptr if not in it.
+    Widget* focus_next_{nullptr};
+    Widget* focus_previous_{nullptr};
+
     // Top left point of *this, relative to the top left of the screen. Does not
     // account for borders.
     Point top_left_position_{0, 0};
@@ -0,0 +1,76 @@
+#ifndef CPPURSES_WIDGET_WIDGETS_FRAME_PROFILER_HPP
+#define CPPURSES_WIDGET_WIDGETS_FRAME_PROFILER_HPP
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <cppurses/system/key.hpp>
+#include <cppurses/system/tracer.hpp>
+#include <cppurses/widget/widgets/text_display.hpp>
+
+namespace cppurses {
+
+/// Displays frame statistics of the main Event_loop, over the last second.
+/** Shows frame time and rate, cells emitted and bytes written, Events
+ *  dispatched and Paint_events coalesced, and the five Widgets that spent the
+ *  most time painting, with their time handling Events of any type.
+ *  Refreshed at most four times a second, all history is kept in fixed size
+ *  buffers. The Tracer is enabled while shown, for the Widget times. Starts
+ *  hidden, \p toggle_key is registered with Shortcuts to show and hide it. */
+class Frame_profiler : public Text_display {
+   public:
+    explicit Frame_profiler(Key toggle_key = Key::Function12);
+
+    /// Shows the profiler if hidden, hides it if shown.
+    void toggle();
+
+    /// Only enables the Widget while shown, hidden it takes no space.
+    void enable(bool enable = true,
+                bool post_child_polished_event = true) override;
+
+   protected:
+    bool timer_event() override;
+
+   private:
+    using Clock_t = std::chrono::steady_clock;
+
+    /// Refreshes per second, also the number of counter samples per second.
+    static constexpr std::size_t refresh_rate{4};
+
+    /// Number of Widgets listed.
+    static constexpr std::size_t top_count{5};
+
+    /// Cumulative counters of the main Event_loop at one point in time.
+    struct Counter_sample {
+        Clock_t::time_point when;
+        std::size_t events_dispatched{0};
+        std::size_t coalesced_paints{0};
+    };
+
+    /// Ring buffer, one second of samples plus the newest.
+    std::array<Counter_sample, refresh_rate + 1> samples_;
+    std::size_t next_sample_{0};
+    std::size_t refreshes_{0};
+
+    /// Totals per Widget a second ago, for the last second's share.
+    std::unordered_map<const Widget*, Tracer::Widget_cost> previous_costs_;
+    std::vector<Tracer::Widget_cost> top_widgets_;
+
+    bool shown_{false};
+    bool tracer_was_enabled_{false};
+
+    void show();
+    void hide();
+
+    /// Takes a counter sample, updates the Widget list once a second.
+    void sample();
+
+    /// Rebuilds the displayed text from the collected samples.
+    void update_text();
+};
+
+}  // namespace cppurses
+#endif  // CPPURSES_WIDGET_WIDGETS_FRAME_PROFILER_HPP
@@ -5,6 +5,11 @@
 
 namespace cppurses {
 
+/// A single line of text that does not take focus.
+/** The paint cache is not enabled, so subclasses that draw more than the text
+ *  are not shown stale. The library's Labels and Label subclasses opt in. Call
+ *  enable_paint_cache() on a Label, or a subclass that only draws its contents
+ *  or calls content_changed() when anything else it draws changes. */
 class Label : public Text_display {
    public:
     explicit Label(Glyph_string text = "");
@@ -57,6 +57,7 @@ struct Labeled_number_edit : cppurses::Horizontal_layout {
         this->height_policy.hint(1);
         label.width_policy.type(cppurses::Size_policy::Fixed);
         label.width_policy.hint(label.contents_size());
+        label.enable_paint_cache();
 
         number_edit.brush.set_background(cppurses::Color::White);
         number_edit.brush.set_foreground(cppurses::Color::Black);
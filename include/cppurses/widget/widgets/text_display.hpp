@@ -23,6 +23,7 @@ class Text_display : public Widget {
         : contents_{std::move(content)} {}
 
     void update() override;
+    using Widget::update;
 
     // Text Modification
     void set_text(Glyph_string text);
@@ -34,6 +35,7 @@ class Text_display : public Widget {
 
     void set_alignment(Alignment type) {
         alignment_ = type;
+        this->content_changed();
         this->update();
     }
 
@@ -46,16 +48,19 @@ class Text_display : public Widget {
     // Word Wrapping
     void enable_word_wrap(bool enable = true) {
         word_wrap_ = enable;
+        this->content_changed();
         this->update();
     }
 
     void disable_word_wrap(bool disable = true) {
         word_wrap_ = !disable;
+        this->content_changed();
         this->update();
     }
 
     void toggle_word_wrap() {
         word_wrap_ = !word_wrap_;
+        this->content_changed();
         this->update();
     }
 
@@ -81,6 +86,8 @@ class Text_display : public Widget {
     std::size_t index_at(std::size_t x, std::size_t y) const;
     Point display_position(std::size_t index) const;
 
+    /// Modifying the contents directly requires a call to content_changed().
+    /** As does modifying a Glyph through glyph_at(). */
     Glyph_string& contents() { return contents_; }
     const Glyph_string& contents() const { return contents_; }
     Glyph& glyph_at(std::size_t index) { return contents_.at(index); }
@@ -3,49 +3,21 @@
 #include <cstddef>
 #include <cstdint>
 
-#include <optional/optional.hpp>
-
-#include <cppurses/painter/attribute.hpp>
-#include <cppurses/painter/color.hpp>
-
-namespace {
-using opt::Optional;
-using namespace cppurses;
-
-void add_background(const Brush& from, Brush& to) {
-    if (!to.background_color() && from.background_color()) {
-        to.add_attributes(background(*from.background_color()));
-    }
-}
-
-void add_foreground(const Brush& from, Brush& to) {
-    if (!to.foreground_color() && from.foreground_color()) {
-        to.add_attributes(foreground(*from.foreground_color()));
-    }
-}
-
-void copy_attributes(const Brush& from, Brush& to) {
-    for (Attribute a : Attribute_list) {
-        if (from.has_attribute(a)) {
-            to.add_attributes(a);
-        }
-    }
-}
-
-}  // namespace
-
 namespace cppurses {
 
-bool operator==(const Brush& lhs, const Brush& rhs) {
-    return (lhs.attributes_ == rhs.attributes_ &&
-            lhs.background_color_ == rhs.background_color_ &&
-            lhs.foreground_color_ == rhs.foreground_color_);
-}
+constexpr std::size_t Brush::color_code_count;
+constexpr std::uint32_t Brush::attributes_mask;
+constexpr std::uint32_t Brush::color_mask;
+constexpr int Brush::background_shift;
+constexpr int Brush::foreground_shift;
 
 void imprint(const Brush& from, Brush& to) {
-    add_background(from, to);
-    add_foreground(from, to);
-    copy_attributes(from, to);
+    for (int shift : {Brush::background_shift, Brush::foreground_shift}) {
+        if (to.color_code(shift) == 0) {
+            to.set_color_code(shift, from.color_code(shift));
+        }
+    }
+    to.bits_ |= from.bits_ & Brush::attributes_mask;
 }
 
 }  // namespace cppurses
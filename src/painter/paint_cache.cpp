@@ -0,0 +1,69 @@
+#include <cppurses/painter/detail/paint_cache.hpp>
+
+#include <cppurses/painter/detail/staged_changes.hpp>
+#include <cppurses/system/event_loop.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/border.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/widget.hpp>
+
+namespace {
+using namespace cppurses;
+
+bool same_border(const Border& x, const Border& y) {
+    return x.enabled == y.enabled && x.north == y.north &&
+           x.south == y.south && x.east == y.east && x.west == y.west &&
+           x.north_west == y.north_west && x.north_east == y.north_east &&
+           x.south_west == y.south_west && x.south_east == y.south_east &&
+           x.north_enabled == y.north_enabled &&
+           x.south_enabled == y.south_enabled &&
+           x.east_enabled == y.east_enabled &&
+           x.west_enabled == y.west_enabled &&
+           x.north_west_enabled == y.north_west_enabled &&
+           x.north_east_enabled == y.north_east_enabled &&
+           x.south_west_enabled == y.south_west_enabled &&
+           x.south_east_enabled == y.south_east_enabled;
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+bool Paint_cache::paint(Widget& w) {
+    auto& changes = System::find_event_loop().staged_changes();
+    const auto key = this->key_of(w);
+    if (valid_ && same(key, key_)) {
+        if (staged_) {
+            changes[&w] = cells_;
+        }
+        return handled_;
+    }
+    const auto complete = w.damage().is_all();
+    handled_ = w.paint_event();
+    const auto staged = changes.find(&w);
+    staged_ = staged != std::end(changes);
+    if (!complete) {
+        this->invalidate();
+        return handled_;
+    }
+    cells_ = staged_ ? staged->second : Screen_descriptor{};
+    key_ = key;
+    valid_ = true;
+    return handled_;
+}
+
+Paint_cache::Key Paint_cache::key_of(const Widget& w) const {
+    return Key{version_, Point{w.x(), w.y()},
+               Area{w.outer_width(), w.outer_height()}, w.brush, w.border};
+}
+
+bool Paint_cache::same(const Key& x, const Key& y) {
+    return x.version == y.version && x.position == y.position &&
+           x.size.width == y.size.width && x.size.height == y.size.height &&
+           x.brush == y.brush && same_border(x.border, y.border);
+}
+
+}  // namespace detail
+}  // namespace cppurses
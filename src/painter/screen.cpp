@@ -1,50 +1,68 @@
 #include <cppurses/painter/detail/screen.hpp>
 
-#include <iterator>
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <vector>
 
-#include <optional/optional.hpp>
-
-#include <cppurses/painter/attribute.hpp>
 #include <cppurses/painter/brush.hpp>
-#include <cppurses/painter/color.hpp>
-#include <cppurses/painter/detail/find_empty_space.hpp>
 #include <cppurses/painter/detail/is_paintable.hpp>
 #include <cppurses/painter/detail/screen_descriptor.hpp>
-#include <cppurses/painter/detail/screen_mask.hpp>
 #include <cppurses/painter/detail/staged_changes.hpp>
 #include <cppurses/painter/glyph.hpp>
 #include <cppurses/system/focus.hpp>
 #include <cppurses/system/system.hpp>
 #include <cppurses/terminal/output.hpp>
+#include <cppurses/terminal/output_backend.hpp>
 #include <cppurses/terminal/terminal.hpp>
+#include <cppurses/widget/area.hpp>
 #include <cppurses/widget/point.hpp>
+#include <cppurses/widget/rect.hpp>
 #include <cppurses/widget/widget.hpp>
 
 namespace {
 using namespace cppurses;
 
-template <typename Map_t>
-bool contains(const typename Map_t::key_type& value, const Map_t& map) {
-    return map.count(value) > 0;
-}
-
 bool has_children(const Widget& widg) {
     return !(widg.children.get().empty());
 }
 
-bool is_whitespace_equal(const Brush& a, const Brush& b) {
-    using Atr_t = Attribute;
-    for (auto attr : {Atr_t::Underline, Atr_t::Standout, Atr_t::Inverse}) {
-        if (a.has_attribute(attr) == b.has_attribute(attr)) {
-            return false;
+/// Calls \p f with each damaged region of \p widg, in global coordinates.
+/** Damaged regions are clipped to the outer area of \p widg. */
+template <typename Function>
+void for_each_damaged_region(const Widget& widg, Function&& f) {
+    const auto x_outer_end = widg.x() + widg.outer_width();
+    const auto y_outer_end = widg.y() + widg.outer_height();
+    const auto& damage = widg.damage();
+    if (damage.is_all()) {
+        f(Rect{Point{widg.x(), widg.y()},
+               Area{widg.outer_width(), widg.outer_height()}});
+        return;
+    }
+    for (const Rect& region : damage.rects()) {
+        const auto x_begin = widg.inner_x() + region.top_left.x;
+        const auto y_begin = widg.inner_y() + region.top_left.y;
+        const auto x_end = std::min(x_begin + region.area.width, x_outer_end);
+        const auto y_end = std::min(y_begin + region.area.height, y_outer_end);
+        if (x_begin < x_end && y_begin < y_end) {
+            f(Rect{Point{x_begin, y_begin},
+                   Area{x_end - x_begin, y_end - y_begin}});
         }
     }
-    return a.background_color() == b.background_color();
 }
 
-bool has_same_display(const Glyph& a, const Glyph& b) {
-    return a == b || (a.symbol == L' ' && b.symbol == L' ' &&
-                      is_whitespace_equal(a.brush, b.brush));
+/// Calls \p f with each global Point of \p widg that is damaged.
+template <typename Function>
+void for_each_damaged_point(const Widget& widg, Function&& f) {
+    for_each_damaged_region(widg, [&f](const Rect& region) {
+        const auto x_end = region.top_left.x + region.area.width;
+        const auto y_end = region.top_left.y + region.area.height;
+        for (auto y = region.top_left.y; y < y_end; ++y) {
+            for (auto x = region.top_left.x; x < x_end; ++x) {
+                f(Point{x, y});
+            }
+        }
+    });
 }
 
 }  // namespace
@@ -52,178 +70,181 @@ bool has_same_display(const Glyph& a, const Glyph& b) {
 namespace cppurses {
 namespace detail {
 
-void Screen::flush(const Staged_changes& changes) {
-    bool refresh = false;
+std::mutex Screen::render_mtx_;
+Screen_descriptor Screen::front_buffer_;
+Screen_descriptor Screen::back_buffer_;
+std::vector<Glyph> Screen::run_;
+bool Screen::cursor_shown_{false};
+Point Screen::cursor_position_;
+
+Screen::Flush_stats Screen::flush(const Staged_changes& changes) {
+    std::lock_guard<std::mutex> lock{render_mtx_};
+    const auto bytes_before = output::bytes_written();
+    this->fit_buffers_to_terminal();
     for (const auto& widg_description : changes) {
         auto& widget = *widg_description.first;
         if (is_paintable(widget)) {
-            delegate_paint(widget, widg_description.second);
-            refresh = true;
+            this->apply_scroll_hint(widget);
+            this->compose(widget, widg_description.second);
         } else {
-            widget.screen_state().tiles.clear();
+            widget.scroll_hint_.clear();
         }
     }
-    if (refresh) {
+    auto stats = Flush_stats{};
+    stats.cells = this->commit_back_buffer();
+    const auto cursor_changed = this->set_cursor_on_focus_widget();
+    if (stats.cells != 0 || cursor_changed) {
         output::refresh();
     }
-}
-
-void Screen::set_cursor_on_focus_widget() {
-    auto* focus = Focus::focus_widget();
-    if (focus != nullptr && focus->cursor.enabled() && is_paintable(*focus)) {
-        System::terminal.show_cursor();
-        const auto x_global = focus->inner_x() + focus->cursor.x();
-        const auto y_global = focus->inner_y() + focus->cursor.y();
-        output::move_cursor(x_global, y_global);
-    } else {
-        System::terminal.show_cursor(false);
-    }
+    stats.bytes = output::bytes_written() - bytes_before;
+    return stats;
 }
 
 // IMPLEMENTATION FUNCTIONS - - - - - - - - - - - - - - - - - - - - - - - - - -
 
-void Screen::paint_empty_tiles(const Widget& widg) {
-    if (!has_children(widg)) {
-        return;
-    }
-    const auto wallpaper = widg.generate_wallpaper();
-    const auto empty_space = find_empty_space(widg);
-    const auto y_begin = empty_space.offset().y;
-    const auto x_begin = empty_space.offset().x;
-    const auto y_end = y_begin + empty_space.area().height;
-    const auto x_end = x_begin + empty_space.area().width;
-    for (auto y = y_begin; y < y_end; ++y) {
-        for (auto x = x_begin; x < x_end; ++x) {
-            if (empty_space.at(x, y)) {
-                output::put(x, y, wallpaper);
-            }
-        }
-    }
-}
-
-void Screen::cover_leftovers(Widget& widg,
-                             const Screen_descriptor& staged_tiles) {
-    const auto& wallpaper = widg.generate_wallpaper();
-    auto& existing_tiles = widg.screen_state().tiles;
-    for (auto iter = std::begin(existing_tiles);
-         iter != std::end(existing_tiles);) {
-        const auto& point = iter->first;
-        if (!contains(point, staged_tiles)) {
-            output::put(point.x, point.y, wallpaper);
-            iter = existing_tiles.erase(iter);
-        } else {
-            ++iter;
-        }
+bool Screen::set_cursor_on_focus_widget() {
+    auto* focus = Focus::focus_widget();
+    const auto shown =
+        focus != nullptr && focus->cursor.enabled() && is_paintable(*focus);
+    auto position = Point{0, 0};
+    if (shown) {
+        position = Point{focus->inner_x() + focus->cursor.x(),
+                         focus->inner_y() + focus->cursor.y()};
+        // Glyphs put this frame have moved the cursor, it is always placed.
+        output::show_cursor_at(position.x, position.y);
     }
-}
-
-void Screen::full_paint_single_point(Widget& widg,
-                                     const Screen_descriptor& staged_tiles,
-                                     const Point& point) {
-    auto& existing_tiles = widg.screen_state().tiles;
-    if (!contains(point, staged_tiles)) {
-        if (!has_children(widg)) {
-            output::put(point.x, point.y, widg.generate_wallpaper());
-            existing_tiles.erase(point);
-        }
+    System::terminal.show_cursor(shown);
+    const auto changed =
+        shown != cursor_shown_ || (shown && position != cursor_position_);
+    cursor_shown_ = shown;
+    cursor_position_ = position;
+    return changed;
+}
+
+void Screen::fit_buffers_to_terminal() {
+    const auto terminal_area =
+        Area{System::terminal.width(), System::terminal.height()};
+    const auto front_area = front_buffer_.area();
+    if (front_area.width == terminal_area.width &&
+        front_area.height == terminal_area.height) {
         return;
     }
-    auto tile = staged_tiles.at(point);
-    imprint(widg.brush, tile.brush);
-    if (!(contains(point, existing_tiles) && existing_tiles[point] == tile)) {
-        output::put(point.x, point.y, tile);
-        existing_tiles[point] = tile;
+    front_buffer_.fit_to(Point{0, 0}, terminal_area);
+    back_buffer_.fit_to(Point{0, 0}, terminal_area);
+    // ncurses has cleared the screen, it is not kept up to date when writing
+    // escape sequences directly.
+    if (System::terminal.output_backend() == Output_backend::Escape_sequence) {
+        front_buffer_.clear();
     }
 }
 
-void Screen::basic_paint_single_point(Widget& widg,
-                                      const Point& point,
-                                      Glyph tile) {
-    imprint(widg.brush, tile.brush);
-    auto& existing_tiles = widg.screen_state().tiles;
-    if (!(contains(point, existing_tiles) && existing_tiles[point] == tile)) {
-        output::put(point.x, point.y, tile);
-        existing_tiles[point] = tile;
+void Screen::put_back(const Point& point, const Glyph& tile) {
+    if (back_buffer_.within_bounds(point)) {
+        back_buffer_.set(point, tile);
     }
 }
 
-void Screen::full_paint(Widget& widg, const Screen_descriptor& staged_tiles) {
-    paint_empty_tiles(widg);
-    const auto y_begin = widg.y();
-    const auto x_begin = widg.x();
-    const auto y_end = y_begin + widg.outer_height();
-    const auto x_end = x_begin + widg.outer_width();
-    for (auto y = y_begin; y < y_end; ++y) {
-        for (auto x = x_begin; x < x_end; ++x) {
-            full_paint_single_point(widg, staged_tiles, Point{x, y});
-        }
+void Screen::apply_scroll_hint(Widget& widg) {
+    auto& hint = widg.scroll_hint_;
+    if (hint.empty()) {
+        return;
     }
-}
-
-void Screen::basic_paint(Widget& widg, const Screen_descriptor& staged_tiles) {
-    cover_leftovers(widg, staged_tiles);
-    for (const auto& point_tile : staged_tiles) {
-        basic_paint_single_point(widg, point_tile.first, point_tile.second);
+    const auto& band = hint.band();
+    const auto lines = hint.lines();
+    const auto distance = static_cast<std::size_t>(lines < 0 ? -lines : lines);
+    const auto screen_width = front_buffer_.area().width;
+    const auto top = band.top_left.y;
+    const auto bottom =
+        std::min(top + band.area.height, front_buffer_.area().height);
+    hint.clear();
+    // Entire rows are scrolled, cells outside of the band are rewritten.
+    if (top >= bottom || distance >= bottom - top ||
+        band.area.width * 2 < screen_width) {
+        return;
     }
-}
-
-void Screen::paint_just_enabled(Widget& widg,
-                                const Screen_descriptor& staged_tiles) {
-    full_paint(widg, staged_tiles);
-}
-
-void Screen::paint_child_event(Widget& widg,
-                               const Screen_descriptor& staged_tiles) {
-    paint_empty_tiles(widg);
-    basic_paint(widg, staged_tiles);
-}
-
-void Screen::paint_resize_event(Widget& widg,
-                                const Screen_descriptor& staged_tiles) {
-    paint_empty_tiles(widg);
-    cover_leftovers(widg, staged_tiles);
-    const auto& new_space = widg.screen_state().optimize.resize_mask;
-    const auto y_begin = new_space.offset().y;
-    const auto x_begin = new_space.offset().x;
-    const auto y_end = y_begin + new_space.area().height;
-    const auto x_end = x_begin + new_space.area().width;
-    for (auto y = y_begin; y < y_end; ++y) {
-        for (auto x = x_begin; x < x_end; ++x) {
+    const auto band_x_end = band.top_left.x + band.area.width;
+    for (auto y = top; y < bottom; ++y) {
+        for (auto x = std::size_t{0}; x < screen_width; ++x) {
             const Point point{x, y};
-            if (new_space.at(x, y)) {
-                full_paint_single_point(widg, staged_tiles, point);
-            } else if (contains(point, staged_tiles)) {
-                basic_paint_single_point(widg, point, staged_tiles.at(point));
+            const auto in_band = x >= band.top_left.x && x < band_x_end;
+            if (!in_band && !back_buffer_.contains(point) &&
+                front_buffer_.contains(point)) {
+                back_buffer_.set(point, front_buffer_.at(point));
             }
         }
     }
+    output::scroll_rows(top, bottom, lines);
+    front_buffer_.scroll_rows(top, bottom, lines);
 }
 
-void Screen::paint_move_event(Widget& widg,
-                              const Screen_descriptor& staged_tiles) {
-    full_paint(widg, staged_tiles);
-}
-
-void Screen::delegate_paint(Widget& widg,
-                            const Screen_descriptor& staged_tiles) {
-    auto& optimization_info = widg.screen_state().optimize;
-    auto& previous_wallpaper = optimization_info.wallpaper;
-    const auto& current_wallpaper = widg.generate_wallpaper();
-    if (optimization_info.just_enabled) {
-        paint_just_enabled(widg, staged_tiles);
-    } else if (!has_same_display(current_wallpaper, previous_wallpaper)) {
-        full_paint(widg, staged_tiles);
-    } else if (optimization_info.moved) {
-        paint_move_event(widg, staged_tiles);
-    } else if (optimization_info.resized) {
-        paint_resize_event(widg, staged_tiles);
-    } else if (optimization_info.child_event) {
-        paint_child_event(widg, staged_tiles);
-    } else {
-        basic_paint(widg, staged_tiles);
+void Screen::compose(Widget& widg, const Screen_descriptor& staged_tiles) {
+    const auto paints_wallpaper = !has_children(widg);
+    const auto wallpaper = widg.generate_wallpaper();
+    const auto put_staged = [&](const Point& point) {
+        auto tile = staged_tiles.at(point);
+        imprint(widg.brush, tile.brush);
+        this->put_back(point, tile);
+    };
+    if (paints_wallpaper) {
+        for_each_damaged_point(widg, [&](const Point& point) {
+            if (staged_tiles.contains(point)) {
+                put_staged(point);
+            } else {
+                this->put_back(point, wallpaper);
+            }
+        });
+        widg.damage_.clear();
+        return;
+    }
+    if (!staged_tiles.empty()) {
+        for_each_damaged_point(widg, [&](const Point& point) {
+            if (staged_tiles.contains(point)) {
+                put_staged(point);
+            }
+        });
     }
-    optimization_info.reset();
-    previous_wallpaper = current_wallpaper;
+    // Wallpaper only goes in the gaps between children, a run per gap.
+    widg.empty_space_.update(widg);
+    for_each_damaged_region(widg, [&](const Rect& region) {
+        widg.empty_space_.for_each_gap(
+            region, [&](std::size_t y, std::size_t x_begin, std::size_t x_end) {
+                for (auto x = x_begin; x < x_end; ++x) {
+                    const Point point{x, y};
+                    if (!staged_tiles.contains(point)) {
+                        this->put_back(point, wallpaper);
+                    }
+                }
+            });
+    });
+    widg.damage_.clear();
+}
+
+std::size_t Screen::commit_back_buffer() {
+    auto cells_output = std::size_t{0};
+    auto run_start = Point{0, 0};
+    auto& run = run_;
+    const auto put_run = [&run, &run_start] {
+        output::put(run_start.x, run_start.y, run.data(), run.size());
+        run.clear();
+    };
+    back_buffer_.for_each([&](const Point& point, const Glyph& tile) {
+        if (front_buffer_.contains(point) && front_buffer_.at(point) == tile) {
+            return;
+        }
+        front_buffer_.set(point, tile);
+        ++cells_output;
+        const auto extends_run = !run.empty() && point.y == run_start.y &&
+                                 point.x == run_start.x + run.size() &&
+                                 run.back().brush == tile.brush;
+        if (!extends_run) {
+            put_run();
+            run_start = point;
+        }
+        run.push_back(tile);
+    });
+    put_run();
+    back_buffer_.clear();
+    return cells_output;
 }
 
 }  // namespace detail
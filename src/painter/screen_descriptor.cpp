@@ -0,0 +1,125 @@
+#include <cppurses/painter/detail/screen_descriptor.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/widget.hpp>
+
+namespace cppurses {
+namespace detail {
+
+Screen_descriptor::Screen_descriptor(const Point& offset, const Area& area)
+    : offset_{offset},
+      area_{area},
+      glyphs_(area_.width * area_.height),
+      is_set_(area_.width * area_.height, false) {}
+
+Screen_descriptor::Screen_descriptor(const Widget& w)
+    : Screen_descriptor{Point{w.x(), w.y()},
+                        Area{w.outer_width(), w.outer_height()}} {}
+
+void Screen_descriptor::fit_to(const Widget& w) {
+    this->fit_to(Point{w.x(), w.y()}, Area{w.outer_width(), w.outer_height()});
+}
+
+void Screen_descriptor::fit_to(const Point& offset, const Area& area) {
+    if (offset == offset_ && area.width == area_.width &&
+        area.height == area_.height) {
+        return;
+    }
+    std::vector<Glyph> glyphs(area.width * area.height);
+    std::vector<bool> is_set(area.width * area.height, false);
+    auto count = std::size_t{0};
+    if (count_ != 0) {
+        const auto y_begin = std::max(offset.y, offset_.y);
+        const auto x_begin = std::max(offset.x, offset_.x);
+        const auto y_end =
+            std::min(offset.y + area.height, offset_.y + area_.height);
+        const auto x_end =
+            std::min(offset.x + area.width, offset_.x + area_.width);
+        for (auto y = y_begin; y < y_end; ++y) {
+            for (auto x = x_begin; x < x_end; ++x) {
+                const auto old_index = this->index_at(Point{x, y});
+                if (is_set_[old_index]) {
+                    const auto index =
+                        ((y - offset.y) * area.width) + (x - offset.x);
+                    glyphs[index] = glyphs_[old_index];
+                    is_set[index] = true;
+                    ++count;
+                }
+            }
+        }
+    }
+    offset_ = offset;
+    area_ = area;
+    count_ = count;
+    glyphs_ = std::move(glyphs);
+    is_set_ = std::move(is_set);
+}
+
+void Screen_descriptor::erase(const Point& p) {
+    if (!this->within_bounds(p)) {
+        return;
+    }
+    const auto index = this->index_at(p);
+    if (is_set_[index]) {
+        is_set_[index] = false;
+        --count_;
+    }
+}
+
+void Screen_descriptor::clear() {
+    if (count_ == 0) {
+        return;
+    }
+    std::fill(std::begin(is_set_), std::end(is_set_), false);
+    count_ = 0;
+}
+
+void Screen_descriptor::scroll_rows(std::size_t top,
+                                    std::size_t bottom,
+                                    std::ptrdiff_t lines) {
+    top = std::max(top, offset_.y);
+    bottom = std::min(bottom, offset_.y + area_.height);
+    if (top >= bottom || lines == 0) {
+        return;
+    }
+    const auto width = static_cast<std::ptrdiff_t>(area_.width);
+    const auto row_begin = [this, width](std::size_t y) {
+        return static_cast<std::ptrdiff_t>(y - offset_.y) * width;
+    };
+    const auto first = row_begin(top);
+    const auto last = row_begin(bottom);
+    count_ -= std::count(std::begin(is_set_) + first,
+                         std::begin(is_set_) + last, true);
+    const auto shift = std::min(lines < 0 ? -lines : lines,
+                                static_cast<std::ptrdiff_t>(bottom - top)) *
+                       width;
+    if (lines > 0) {
+        std::move(std::begin(glyphs_) + first + shift,
+                  std::begin(glyphs_) + last, std::begin(glyphs_) + first);
+        std::copy(std::begin(is_set_) + first + shift,
+                  std::begin(is_set_) + last, std::begin(is_set_) + first);
+        std::fill(std::begin(is_set_) + last - shift,
+                  std::begin(is_set_) + last, false);
+    } else {
+        std::move_backward(std::begin(glyphs_) + first,
+                           std::begin(glyphs_) + last - shift,
+                           std::begin(glyphs_) + last);
+        std::copy_backward(std::begin(is_set_) + first,
+                           std::begin(is_set_) + last - shift,
+                           std::begin(is_set_) + last);
+        std::fill(std::begin(is_set_) + first,
+                  std::begin(is_set_) + first + shift, false);
+    }
+    count_ += std::count(std::begin(is_set_) + first,
+                         std::begin(is_set_) + last, true);
+}
+
+}  // namespace detail
+}  // namespace cppurses
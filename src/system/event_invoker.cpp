@@ -1,5 +1,6 @@
 #include <cppurses/system/detail/event_invoker.hpp>
 
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <utility>
@@ -8,17 +9,7 @@
 #include <cppurses/system/detail/event_queue.hpp>
 #include <cppurses/system/event.hpp>
 #include <cppurses/system/system.hpp>
-
-// #define DEBUG_EVENT_INVOKER
-
-#if defined(DEBUG_EVENT_INVOKER)
-#include <fstream>
-#include <string>
-#include <unordered_map>
-
-#include <cppurses/system/detail/event_as_string.hpp>
-#include <cppurses/widget/widget.hpp>
-#endif
+#include <cppurses/system/tracer.hpp>
 
 namespace {
 using namespace cppurses;
@@ -44,43 +35,32 @@ namespace detail {
 void Event_invoker::invoke(Event_queue& queue,
                            Event::Type type_filter,
                            Widget* object_filter) {
-#if defined(DEBUG_EVENT_INVOKER)
-    std::unordered_map<Widget*, std::vector<Event::Type>> widgs;
-#endif
-    auto event_iter = std::begin(queue.queue_);
-    while (event_iter != std::end(queue.queue_)) {
-        auto& receiver = (*event_iter)->receiver();
-        auto event_type = (*event_iter)->type();
-        if (is_ignorable(event_type, type_filter) ||
-            is_ignorable(receiver, object_filter)) {
-            ++event_iter;
-        } else if (type_filter == Event::None || type_filter == event_type) {
-#if defined(DEBUG_EVENT_INVOKER)
-            widgs[&receiver].push_back(event_type);
-#endif
-            auto event = std::move(*event_iter);
-            queue.queue_.erase(event_iter);
-            System::send_event(*event);
-            event_iter = std::begin(queue.queue_);
-        }
-    }
-#if defined(DEBUG_EVENT_INVOKER)
-    auto l = std::ofstream{"events_log.txt", std::ios::app};
-    for (const auto& widg_event : widgs) {
-        l << widg_event.first;
-        l << ' ' << widg_event.first->name();
-        l << ":\n\t";
-        auto seperator = std::string{""};
-        for (Event::Type event_t : widg_event.second) {
-            l << seperator << event_type_as_string(event_t);
-            seperator = ", ";
+    // Events appended while sending are invoked in the next Batch.
+    auto invoked = true;
+    while (invoked && queue.lane_for(type_filter).size != 0) {
+        invoked = false;
+        // Sending can destroy Widgets, which empties their slots in batch.
+        auto& batch = queue.take_batch(type_filter);
+        for (auto i = std::size_t{0}; i < batch.size(); ++i) {
+            auto& event = batch[i];
+            if (event == nullptr) {
+                continue;
+            }
+            auto& receiver = event->receiver();
+            auto event_type = event->type();
+            if (is_ignorable(event_type, type_filter) ||
+                is_ignorable(receiver, object_filter) ||
+                (type_filter != Event::None && type_filter != event_type)) {
+                continue;
+            }
+            const auto to_send = std::move(event);
+            const Tracer::Event_scope trace{*to_send};
+            System::send_event(*to_send);
+            ++dispatched_;
+            invoked = true;
         }
-        l << '\n';
+        queue.requeue(type_filter);
     }
-    l << "\n--->End Queue Invokation. type_filter: "
-      << event_type_as_string(type_filter);
-    l << std::endl;
-#endif
 }
 
 }  // namespace detail
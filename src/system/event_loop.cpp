@@ -1,14 +1,19 @@
 #include <cppurses/system/event_loop.hpp>
 
+#include <chrono>
 #include <future>
-#include <mutex>
+#include <memory>
 #include <thread>
 #include <utility>
 
+#include <cppurses/painter/detail/screen.hpp>
 #include <cppurses/painter/detail/staged_changes.hpp>
 #include <cppurses/system/detail/event_invoker.hpp>
+#include <cppurses/system/detail/event_mailbox.hpp>
+#include <cppurses/system/detail/render_scheduler.hpp>
 #include <cppurses/system/event.hpp>
 #include <cppurses/system/system.hpp>
+#include <cppurses/system/tracer.hpp>
 
 namespace cppurses {
 
@@ -21,7 +26,9 @@ Event_loop::Event_loop(Event_loop&& other)
       exit_{other.exit_.load()},
       running_{std::move(other.running_)},
       event_queue_{std::move(other.event_queue_)},
+      mailbox_{std::move(other.mailbox_)},
       invoker_{std::move(other.invoker_)},
+      scheduler_{std::move(other.scheduler_)},
       staged_changes_{std::move(other.staged_changes_)},
       screen_{std::move(other.screen_)} {}
 
@@ -33,7 +40,9 @@ Event_loop& Event_loop::operator=(Event_loop&& other) {
         exit_ = other.exit_.load();
         running_ = std::move(other.running_);
         event_queue_ = std::move(other.event_queue_);
+        mailbox_ = std::move(other.mailbox_);
         invoker_ = std::move(other.invoker_);
+        scheduler_ = std::move(other.scheduler_);
         staged_changes_ = std::move(other.staged_changes_);
         screen_ = std::move(other.screen_);
     }
@@ -67,21 +76,54 @@ int Event_loop::wait() {
     return -1;
 }
 
+detail::Render_scheduler::Stats Event_loop::render_stats() const {
+    auto stats = scheduler_.stats();
+    stats.coalesced_paints = event_queue_.coalesced_paints();
+    stats.events_dispatched = invoker_.dispatched();
+    return stats;
+}
+
+void Event_loop::discard_events(const Widget& receiver) {
+    mailbox_.take_all([this](std::unique_ptr<Event> event) {
+        event_queue_.append(std::move(event));
+    });
+    event_queue_.remove_events(receiver);
+}
+
 void Event_loop::process_events() {
-    // only one event loop at a time can be invoking its queue.
-    static std::mutex mtx;
-    mtx.lock();
+    mailbox_.take_all([this](std::unique_ptr<Event> event) {
+        event_queue_.append(std::move(event));
+    });
     invoker_.invoke(event_queue_);
     if (!exit_) {
-        invoker_.invoke(event_queue_, Event::Paint);
-        screen_.flush(staged_changes_);
-        screen_.set_cursor_on_focus_widget();
-        staged_changes_.clear();
-        invoker_.invoke(event_queue_, Event::Delete);
-        mtx.unlock();
+        if (this != &System::main_event_loop()) {
+            // Only the main loop touches the terminal, it paints for others.
+            auto paints = event_queue_.take_all(Event::Paint);
+            if (!paints.empty()) {
+                System::main_event_loop().post_events(std::move(paints));
+            }
+            invoker_.invoke(event_queue_, Event::Delete);
+        } else if (scheduler_.frame_due()) {
+            const auto frame_start = detail::Render_scheduler::Clock_t::now();
+            {
+                const Tracer::Frame_scope trace{Tracer::Phase::Paint};
+                invoker_.invoke(event_queue_, Event::Paint);
+            }
+            auto output = detail::Screen::Flush_stats{};
+            {
+                const Tracer::Frame_scope trace{Tracer::Phase::Flush};
+                output = screen_.flush(staged_changes_);
+            }
+            const auto duration =
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    detail::Render_scheduler::Clock_t::now() - frame_start);
+            staged_changes_.clear();
+            invoker_.invoke(event_queue_, Event::Delete);
+            scheduler_.frame_flushed(duration, output.cells, output.bytes);
+        } else if (!event_queue_.empty()) {
+            scheduler_.frame_deferred();
+        }
         this->loop_function();
-    } else {
-        mtx.unlock();
     }
 }
 
@@ -0,0 +1,111 @@
+#include <cppurses/system/detail/event_pool.hpp>
+
+#include <array>
+#include <cstddef>
+#include <new>
+
+namespace {
+using cppurses::detail::Event_pool;
+
+/// Block sizes are smallest_block, doubling for each following class.
+const std::size_t smallest_block{32};
+const std::size_t class_count{4};
+
+/// Free blocks kept per size class, beyond this blocks are released.
+const std::size_t max_free_blocks{512};
+
+/// Returns the size class for \p size, class_count if too large for a class.
+std::size_t size_class(std::size_t size) {
+    auto index = std::size_t{0};
+    auto block = smallest_block;
+    while (index < class_count && size > block) {
+        ++index;
+        block *= 2;
+    }
+    return index;
+}
+
+std::size_t block_size(std::size_t size_class) {
+    return smallest_block << size_class;
+}
+
+struct Free_block {
+    Free_block* next;
+};
+
+/// Set once the pool of this thread has been destroyed, at thread exit.
+thread_local bool pool_destroyed{false};
+
+struct Thread_pool {
+    std::array<Free_block*, class_count> free_lists{};
+    std::array<std::size_t, class_count> free_counts{};
+    Event_pool::Stats stats;
+
+    ~Thread_pool() {
+        for (Free_block* block : free_lists) {
+            while (block != nullptr) {
+                Free_block* next = block->next;
+                ::operator delete(block);
+                block = next;
+            }
+        }
+        pool_destroyed = true;
+    }
+};
+
+thread_local Thread_pool pool;
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+void* Event_pool::allocate(std::size_t size) {
+    const auto index = size_class(size);
+    if (pool_destroyed) {
+        return ::operator new(index < class_count ? block_size(index) : size);
+    }
+    ++pool.stats.allocations;
+    if (index == class_count) {
+        ++pool.stats.global_allocations;
+        return ::operator new(size);
+    }
+    Free_block* block = pool.free_lists[index];
+    if (block == nullptr) {
+        ++pool.stats.global_allocations;
+        return ::operator new(block_size(index));
+    }
+    pool.free_lists[index] = block->next;
+    --pool.free_counts[index];
+    ++pool.stats.reused;
+    return block;
+}
+
+void Event_pool::deallocate(void* block, std::size_t size) noexcept {
+    if (block == nullptr) {
+        return;
+    }
+    const auto index = size_class(size);
+    if (pool_destroyed) {
+        ::operator delete(block);
+        return;
+    }
+    ++pool.stats.deallocations;
+    if (index == class_count || pool.free_counts[index] == max_free_blocks) {
+        ::operator delete(block);
+        return;
+    }
+    auto* freed = ::new (block) Free_block{pool.free_lists[index]};
+    pool.free_lists[index] = freed;
+    ++pool.free_counts[index];
+}
+
+Event_pool::Stats Event_pool::stats() {
+    if (pool_destroyed) {
+        return Stats{};
+    }
+    return pool.stats;
+}
+
+}  // namespace detail
+}  // namespace cppurses
@@ -1,44 +1,22 @@
 #include <cppurses/system/detail/event_queue.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <initializer_list>
 #include <iterator>
 #include <memory>
 #include <utility>
 
 #include <cppurses/system/detail/is_sendable.hpp>
 #include <cppurses/system/event.hpp>
+#include <cppurses/system/tracer.hpp>
 #include <cppurses/widget/children_data.hpp>
 #include <cppurses/widget/widget.hpp>
 
 namespace {
 using namespace cppurses;
 
-template <typename Queue_t>
-void remove_descendant_events(const Widget& receiver, Queue_t& queue) {
-    auto is_descendant = [&receiver](const std::unique_ptr<Event>& on_queue) {
-        return receiver.children.has_descendant(&(on_queue->receiver()));
-    };
-    auto at = std::remove_if(std::begin(queue), std::end(queue), is_descendant);
-    queue.erase(at, std::end(queue));
-}
-
-auto is(const Widget& receiver, Event::Type event_type) {
-    return [event_type, &receiver](const std::unique_ptr<Event>& on_queue) {
-        return &receiver == &(on_queue->receiver()) &&
-               on_queue->type() == event_type;
-    };
-}
-
-// Returns true if an event was removed from the queue.
-template <typename Queue_t>
-bool remove(const Widget& receiver, Event::Type type, Queue_t& queue) {
-    const auto begin = std::begin(queue);
-    const auto end = std::end(queue);
-    const auto erase_iter = std::remove_if(begin, end, is(receiver, type));
-    queue.erase(erase_iter, end);
-    return erase_iter != end;
-}
-
+/// At most one Event of these types is queued per receiver, they are indexed.
 bool is_expensive(Event::Type type) {
     return type == Event::Paint || type == Event::Move ||
            type == Event::Resize || type == Event::Disable ||
@@ -54,26 +32,137 @@ void Event_queue::append(std::unique_ptr<Event> event) {
     if (event == nullptr || !is_sendable(*event)) {
         return;
     }
+    if (Tracer::enabled()) {
+        event->queued_time_ = Tracer::Clock_t::now();
+    }
     // Remove canceling out Enable/Disable pairs.
     auto type = event->type();
     if (type == Event::Enable) {
-        bool event_removed = remove(event->receiver(), Event::Disable, queue_);
-        if (event_removed) {
+        if (this->remove(event->receiver(), Event::Disable)) {
             return;
         }
     } else if (type == Event::Disable) {
-        bool event_removed = remove(event->receiver(), Event::Enable, queue_);
-        if (event_removed) {
+        if (this->remove(event->receiver(), Event::Enable)) {
             return;
         }
     }
+    auto& lane = this->lane_for(type);
     if (is_expensive(type)) {
-        remove(event->receiver(), type, queue_);
+        const bool event_removed = this->remove(event->receiver(), type);
+        if (event_removed && type == Event::Paint) {
+            ++coalesced_paints_;
+        }
+        lane.index[Key{&event->receiver(), type}] = lane.events.size();
+    }
+    if (type == Event::Delete) {
+        this->remove_descendant_events(event->receiver());
+    }
+    lane.events.emplace_back(std::move(event));
+    ++lane.size;
+}
+
+Event_queue::Lane& Event_queue::lane_for(Event::Type type) {
+    if (type == Event::Paint) {
+        return paints_;
     }
     if (type == Event::Delete) {
-        remove_descendant_events(event->receiver(), queue_);
+        return deletes_;
+    }
+    return general_;
+}
+
+std::vector<std::unique_ptr<Event>> Event_queue::take_all(Event::Type type) {
+    auto& lane = this->lane_for(type);
+    Batch batch;
+    batch.swap(lane.events);
+    lane.index.clear();
+    lane.size = 0;
+    batch.erase(std::remove(std::begin(batch), std::end(batch), nullptr),
+                std::end(batch));
+    return batch;
+}
+
+Event_queue::Batch& Event_queue::take_batch(Event::Type type) {
+    auto& lane = this->lane_for(type);
+    lane.in_flight.swap(lane.events);
+    lane.index.clear();
+    lane.size = 0;
+    return lane.in_flight;
+}
+
+void Event_queue::requeue(Event::Type type) {
+    auto& lane = this->lane_for(type);
+    Batch batch;
+    batch.swap(lane.in_flight);
+    batch.erase(std::remove_if(std::begin(batch), std::end(batch),
+                               [&lane](const std::unique_ptr<Event>& event) {
+                                   return event == nullptr ||
+                                          lane.index.count(Key{
+                                              &event->receiver(),
+                                              event->type()}) != 0;
+                               }),
+                std::end(batch));
+    if (batch.empty()) {
+        return;
+    }
+    for (auto& slot : lane.index) {
+        slot.second += batch.size();
+    }
+    for (auto i = std::size_t{0}; i < batch.size(); ++i) {
+        if (is_expensive(batch[i]->type())) {
+            lane.index[Key{&batch[i]->receiver(), batch[i]->type()}] = i;
+        }
+    }
+    lane.size += batch.size();
+    batch.insert(std::end(batch),
+                 std::make_move_iterator(std::begin(lane.events)),
+                 std::make_move_iterator(std::end(lane.events)));
+    lane.events = std::move(batch);
+}
+
+bool Event_queue::remove(const Widget& receiver, Event::Type type) {
+    auto& lane = this->lane_for(type);
+    const auto found = lane.index.find(Key{&receiver, type});
+    if (found == std::end(lane.index)) {
+        return false;
     }
-    queue_.emplace_back(std::move(event));
+    lane.events[found->second].reset();
+    lane.index.erase(found);
+    --lane.size;
+    return true;
+}
+
+template <typename Predicate>
+void Event_queue::remove_if(Predicate&& predicate) {
+    for (Lane* lane : {&general_, &paints_, &deletes_}) {
+        for (auto& event : lane->events) {
+            if (event == nullptr || !predicate(*event)) {
+                continue;
+            }
+            if (is_expensive(event->type())) {
+                lane->index.erase(Key{&event->receiver(), event->type()});
+            }
+            event.reset();
+            --lane->size;
+        }
+        for (auto& event : lane->in_flight) {
+            if (event != nullptr && predicate(*event)) {
+                event.reset();
+            }
+        }
+    }
+}
+
+void Event_queue::remove_events(const Widget& receiver) {
+    this->remove_if([&receiver](const Event& event) {
+        return &event.receiver() == &receiver;
+    });
+}
+
+void Event_queue::remove_descendant_events(const Widget& receiver) {
+    this->remove_if([&receiver](const Event& event) {
+        return receiver.children.has_descendant(&event.receiver());
+    });
 }
 
 }  // namespace detail
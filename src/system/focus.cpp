@@ -1,11 +1,9 @@
 #include <cppurses/system/focus.hpp>
 
 #include <algorithm>
-#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <utility>
-#include <vector>
 
 #include <cppurses/system/event.hpp>
 #include <cppurses/system/events/focus_event.hpp>
@@ -25,46 +23,13 @@ bool is_click_focus_policy(Focus_policy policy) {
     return policy == Focus_policy::Strong || policy == Focus_policy::Click;
 }
 
-const auto is_tab_focusable = [](const auto* widg) {
-    return widg->enabled() && is_tab_focus_policy(widg->focus_policy);
-};
-
-// Returns a widg tree from System::head() if focus_widget is nullptr.
-auto gen_focus_front_widg_tree() {
-    auto widg_tree = System::head()->children.get_descendants();
-    widg_tree.insert(std::begin(widg_tree), System::head());
-    auto* const focus_widg = Focus::focus_widget();
-    if (focus_widg != nullptr) {
-        const auto begin = std::begin(widg_tree);
-        const auto end = std::end(widg_tree);
-        const auto iter = std::find(begin, end, focus_widg);
-        if (iter != end) {
-            std::rotate(begin, iter, end);
+bool is_in_head_tree(const Widget& w) {
+    for (const Widget* p = &w; p != nullptr; p = p->parent()) {
+        if (p == System::head()) {
+            return true;
         }
     }
-    return widg_tree;
-}
-
-Widget* next_tab_focus() {
-    if (System::head() == nullptr) {
-        return nullptr;
-    }
-    const auto widg_tree = gen_focus_front_widg_tree();
-    const auto begin = std::next(std::begin(widg_tree));
-    const auto end = std::end(widg_tree);
-    const auto next_focus = std::find_if(begin, end, is_tab_focusable);
-    return next_focus != end ? *next_focus : Focus::focus_widget();
-}
-
-Widget* previous_tab_focus() {
-    if (System::head() == nullptr) {
-        return nullptr;
-    }
-    const auto widg_tree = gen_focus_front_widg_tree();
-    const auto begin = std::rbegin(widg_tree);
-    const auto end = std::rend(widg_tree);
-    const auto previous_focus = std::find_if(begin, end, is_tab_focusable);
-    return previous_focus != end ? *previous_focus : Focus::focus_widget();
+    return false;
 }
 
 }  // namespace
@@ -72,6 +37,7 @@ Widget* previous_tab_focus() {
 namespace cppurses {
 
 Widget* Focus::focus_widget_ = nullptr;
+Widget* Focus::chain_first_ = nullptr;
 
 void Focus::mouse_press(Widget* clicked) {
     if (clicked == focus_widget_) {
@@ -84,7 +50,7 @@ void Focus::mouse_press(Widget* clicked) {
 
 bool Focus::tab_press() {
     if (is_tab_focus_policy(focus_widget_->focus_policy)) {
-        Widget* next = next_tab_focus();
+        Widget* next = Focus::next_tab_focus();
         Focus::set_focus_to(next);
         return true;
     }
@@ -93,7 +59,7 @@ bool Focus::tab_press() {
 
 bool Focus::shift_tab_press() {
     if (is_tab_focus_policy(focus_widget_->focus_policy)) {
-        Widget* previous = previous_tab_focus();
+        Widget* previous = Focus::previous_tab_focus();
         Focus::set_focus_to(previous);
         return true;
     }
@@ -130,4 +96,138 @@ void Focus::clear_focus() {
     }
 }
 
+void Focus::update_chain(Widget& w) {
+    const bool belongs = w.enabled() && is_tab_focus_policy(w.focus_policy) &&
+                         is_in_head_tree(w);
+    if (belongs == Focus::is_linked(w)) {
+        return;
+    }
+    if (belongs) {
+        Focus::link_after(w, Focus::previous_linked(w));
+    } else {
+        Focus::unlink(w);
+    }
+}
+
+void Focus::update_chain_tree(Widget& w) {
+    Focus::update_chain(w);
+    for (const std::unique_ptr<Widget>& child : w.children.get()) {
+        Focus::update_chain_tree(*child);
+    }
+}
+
+void Focus::unlink(Widget& w) {
+    if (!Focus::is_linked(w)) {
+        return;
+    }
+    if (w.focus_next_ == &w) {
+        chain_first_ = nullptr;
+    } else {
+        w.focus_previous_->focus_next_ = w.focus_next_;
+        w.focus_next_->focus_previous_ = w.focus_previous_;
+        if (chain_first_ == &w) {
+            chain_first_ = w.focus_next_;
+        }
+    }
+    w.focus_next_ = nullptr;
+    w.focus_previous_ = nullptr;
+}
+
+void Focus::reset_chain() {
+    while (chain_first_ != nullptr) {
+        Focus::unlink(*chain_first_);
+    }
+    if (System::head() != nullptr) {
+        Focus::update_chain_tree(*System::head());
+    }
+}
+
+bool Focus::is_linked(const Widget& w) {
+    return w.focus_next_ != nullptr;
+}
+
+void Focus::link_after(Widget& w, Widget* previous) {
+    if (chain_first_ == nullptr) {
+        w.focus_next_ = &w;
+        w.focus_previous_ = &w;
+        chain_first_ = &w;
+        return;
+    }
+    // No previous Widget means w comes first, after the last Widget.
+    const bool first = previous == nullptr;
+    if (first) {
+        previous = chain_first_->focus_previous_;
+    }
+    w.focus_previous_ = previous;
+    w.focus_next_ = previous->focus_next_;
+    previous->focus_next_->focus_previous_ = &w;
+    previous->focus_next_ = &w;
+    if (first) {
+        chain_first_ = &w;
+    }
+}
+
+Widget* Focus::previous_linked(const Widget& w) {
+    const Widget* current = &w;
+    while (current != System::head() && current->parent() != nullptr) {
+        const Widget& parent = *current->parent();
+        const auto& siblings = parent.children.get();
+        auto iter = std::find_if(std::begin(siblings), std::end(siblings),
+                                 [current](const std::unique_ptr<Widget>& c) {
+                                     return c.get() == current;
+                                 });
+        while (iter != std::begin(siblings)) {
+            --iter;
+            Widget* last = Focus::last_linked_in(**iter);
+            if (last != nullptr) {
+                return last;
+            }
+        }
+        if (Focus::is_linked(parent)) {
+            return current->parent();
+        }
+        current = &parent;
+    }
+    return nullptr;
+}
+
+Widget* Focus::last_linked_in(Widget& root) {
+    const auto& children = root.children.get();
+    for (auto c = std::rbegin(children); c != std::rend(children); ++c) {
+        Widget* last = Focus::last_linked_in(**c);
+        if (last != nullptr) {
+            return last;
+        }
+    }
+    return Focus::is_linked(root) ? &root : nullptr;
+}
+
+Widget* Focus::next_tab_focus() {
+    if (chain_first_ == nullptr) {
+        return focus_widget_;
+    }
+    if (Focus::is_linked(*focus_widget_)) {
+        return focus_widget_->focus_next_;
+    }
+    if (is_in_head_tree(*focus_widget_)) {
+        Widget* previous = Focus::previous_linked(*focus_widget_);
+        return previous != nullptr ? previous->focus_next_ : chain_first_;
+    }
+    return chain_first_;
+}
+
+Widget* Focus::previous_tab_focus() {
+    if (chain_first_ == nullptr) {
+        return focus_widget_;
+    }
+    if (Focus::is_linked(*focus_widget_)) {
+        return focus_widget_->focus_previous_;
+    }
+    if (is_in_head_tree(*focus_widget_)) {
+        Widget* previous = Focus::previous_linked(*focus_widget_);
+        return previous != nullptr ? previous : chain_first_->focus_previous_;
+    }
+    return chain_first_->focus_previous_;
+}
+
 }  // namespace cppurses
@@ -0,0 +1,217 @@
+#include <cppurses/system/detail/hit_map.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/children_data.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/rect.hpp>
+#include <cppurses/widget/widget.hpp>
+#include <cppurses/widget/widget_free_functions.hpp>
+
+namespace {
+using namespace cppurses;
+using Index_t = std::uint16_t;
+
+/// Past this many out of date rectangles the whole map is repainted.
+const std::size_t max_dirty_rects{32};
+
+std::mutex map_mtx;
+
+// Guarded by map_mtx.
+Area grid_area{0, 0};
+std::vector<Index_t> cells;  // Row major, index 0 is no Widget.
+std::vector<Widget*> owners{nullptr};
+std::unordered_map<const Widget*, Index_t> indices;
+std::vector<Index_t> free_indices;
+std::vector<Rect> dirty_rects;
+bool all_dirty{true};
+bool out_of_indices{false};
+
+Rect outer_rect(const Widget& w) {
+    return Rect{Point{w.x(), w.y()}, Area{w.outer_width(), w.outer_height()}};
+}
+
+Rect inner_rect(const Widget& w) {
+    return Rect{Point{w.inner_x(), w.inner_y()}, Area{w.width(), w.height()}};
+}
+
+/// Returns the overlap of \p a and \p b, with an empty Area if none.
+Rect intersection(const Rect& a, const Rect& b) {
+    const auto left = std::max(a.top_left.x, b.top_left.x);
+    const auto top = std::max(a.top_left.y, b.top_left.y);
+    const auto right = std::min(a.top_left.x + a.area.width,
+                                b.top_left.x + b.area.width);
+    const auto bottom = std::min(a.top_left.y + a.area.height,
+                                 b.top_left.y + b.area.height);
+    if (left >= right || top >= bottom) {
+        return Rect{Point{left, top}, Area{0, 0}};
+    }
+    return Rect{Point{left, top}, Area{right - left, bottom - top}};
+}
+
+void fill(const Rect& r, Index_t index) {
+    for (auto y = r.top_left.y; y < r.top_left.y + r.area.height; ++y) {
+        const auto row = std::begin(cells) + y * grid_area.width;
+        std::fill(row + r.top_left.x, row + r.top_left.x + r.area.width,
+                  index);
+    }
+}
+
+/// Returns the index of \p w, assigning one if it has none.
+Index_t index_of(Widget& w) {
+    const auto found = indices.find(&w);
+    if (found != std::end(indices)) {
+        return found->second;
+    }
+    Index_t index{0};
+    if (!free_indices.empty()) {
+        index = free_indices.back();
+        free_indices.pop_back();
+        owners[index] = &w;
+    } else if (owners.size() <= std::numeric_limits<Index_t>::max()) {
+        index = static_cast<Index_t>(owners.size());
+        owners.push_back(&w);
+    } else {
+        out_of_indices = true;
+        return 0;
+    }
+    indices.emplace(&w, index);
+    return index;
+}
+
+/// Gives \p w the cells of \p clip in its inner area, then its children.
+/** Children are painted last to first, so the first child listed wins where
+ *  children overlap, as a walk down the tree would find. */
+void paint(Widget& w, const Rect& clip) {
+    if (!w.enabled()) {
+        return;
+    }
+    const auto owned = intersection(inner_rect(w), clip);
+    if (owned.area.width == 0) {
+        return;
+    }
+    fill(owned, index_of(w));
+    const auto& children = w.children.get();
+    for (auto c = children.rbegin(); c != children.rend(); ++c) {
+        paint(**c, owned);
+    }
+}
+
+/// Repaints the out of date cells, resizing the map to the head Widget.
+void refresh() {
+    Widget* const head = System::head();
+    const auto extent =
+        head == nullptr ? Area{0, 0}
+                        : Area{head->x() + head->outer_width(),
+                               head->y() + head->outer_height()};
+    if (extent.width != grid_area.width || extent.height != grid_area.height) {
+        grid_area = extent;
+        cells.assign(grid_area.width * grid_area.height, 0);
+        all_dirty = true;
+    }
+    const auto whole = Rect{Point{0, 0}, grid_area};
+    if (all_dirty) {
+        out_of_indices = false;
+        dirty_rects.assign(1, whole);
+        all_dirty = false;
+    }
+    for (const Rect& r : dirty_rects) {
+        const auto clipped = intersection(r, whole);
+        if (clipped.area.width == 0) {
+            continue;
+        }
+        fill(clipped, 0);
+        if (head != nullptr) {
+            paint(*head, clipped);
+        }
+    }
+    dirty_rects.clear();
+    if (out_of_indices) {
+        all_dirty = true;
+    }
+}
+
+void add_dirty(const Rect& r) {
+    if (all_dirty || r.area.width == 0 || r.area.height == 0) {
+        return;
+    }
+    if (dirty_rects.size() == max_dirty_rects) {
+        all_dirty = true;
+        dirty_rects.clear();
+        return;
+    }
+    dirty_rects.push_back(r);
+}
+
+/// Walks down from the head, used when there are more Widgets than indices.
+Widget* walk_from_head(std::size_t x, std::size_t y) {
+    Widget* widg = System::head();
+    if (widg == nullptr || !has_coordinates(*widg, x, y)) {
+        return nullptr;
+    }
+    bool keep_going = true;
+    while (keep_going && !widg->children.get().empty()) {
+        for (const auto& child : widg->children.get()) {
+            if (has_coordinates(*child, x, y) && child->enabled()) {
+                widg = child.get();
+                keep_going = true;
+                break;
+            }
+            keep_going = false;
+        }
+    }
+    return widg;
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+Widget* Hit_map::widget_at(std::size_t x, std::size_t y) {
+    std::lock_guard<std::mutex> lock{map_mtx};
+    refresh();
+    if (out_of_indices) {
+        return walk_from_head(x, y);
+    }
+    if (x >= grid_area.width || y >= grid_area.height) {
+        return nullptr;
+    }
+    return owners[cells[y * grid_area.width + x]];
+}
+
+void Hit_map::invalidate(const Widget& w) {
+    std::lock_guard<std::mutex> lock{map_mtx};
+    add_dirty(outer_rect(w));
+}
+
+void Hit_map::invalidate_all() {
+    std::lock_guard<std::mutex> lock{map_mtx};
+    all_dirty = true;
+    dirty_rects.clear();
+}
+
+void Hit_map::forget(const Widget& w) {
+    std::lock_guard<std::mutex> lock{map_mtx};
+    const auto found = indices.find(&w);
+    if (found == std::end(indices)) {
+        return;
+    }
+    owners[found->second] = nullptr;
+    free_indices.push_back(found->second);
+    indices.erase(found);
+    add_dirty(outer_rect(w));
+}
+
+}  // namespace detail
+}  // namespace cppurses
@@ -1,31 +1,48 @@
 #include <cppurses/system/events/move_event.hpp>
 
-#include <cppurses/painter/detail/screen_descriptor.hpp>
-#include <cppurses/painter/detail/screen_mask.hpp>
-#include <cppurses/painter/detail/screen_state.hpp>
+#include <algorithm>
+#include <cstddef>
+
+#include <cppurses/system/detail/hit_map.hpp>
 #include <cppurses/system/event.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/children_data.hpp>
 #include <cppurses/widget/point.hpp>
+#include <cppurses/widget/rect.hpp>
 #include <cppurses/widget/widget.hpp>
 
 namespace cppurses {
 
 bool Move_event::send() const {
     if (receiver_.x() != new_position_.x || receiver_.y() != new_position_.y) {
-        receiver_.screen_state().optimize.moved = true;
-        // Create and set move_mask in receiver_.screen_state()
-        receiver_.screen_state().optimize.move_mask =
-            detail::Screen_mask(receiver_, detail::Screen_mask::Outer);
-        receiver_.screen_state()
-            .tiles.clear();  // TODO remove this once opt impl.
         old_position_.x = receiver_.x();
         old_position_.y = receiver_.y();
+        detail::Hit_map::invalidate(receiver_);
         receiver_.set_x(new_position_.x);
         receiver_.set_y(new_position_.y);
+        detail::Hit_map::invalidate(receiver_);
+        this->hint_vertical_move();
         return receiver_.move_event(new_position_, old_position_);
     }
     return true;
 }
 
+void Move_event::hint_vertical_move() const {
+    // Children are moved by their own Move_events, hint only once per cell.
+    if (old_position_.x != new_position_.x ||
+        !receiver_.children.get().empty()) {
+        return;
+    }
+    const auto top = std::min(old_position_.y, new_position_.y);
+    const auto distance = std::max(old_position_.y, new_position_.y) - top;
+    const auto height = receiver_.outer_height() + distance;
+    const auto band = Rect{Point{new_position_.x, top},
+                           Area{receiver_.outer_width(), height}};
+    receiver_.scroll_hint_.add(
+        band, static_cast<std::ptrdiff_t>(old_position_.y) -
+                  static_cast<std::ptrdiff_t>(new_position_.y));
+}
+
 bool Move_event::filter_send(Widget& filter) const {
     if (receiver_.x() != new_position_.x || receiver_.y() != new_position_.y) {
         return filter.move_event_filter(receiver_, new_position_,
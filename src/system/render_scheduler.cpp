@@ -0,0 +1,15 @@
+#include <cppurses/system/detail/render_scheduler.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+namespace cppurses {
+namespace detail {
+
+constexpr std::size_t Render_scheduler::frame_history_size;
+
+std::atomic<Render_scheduler::Period_t> Render_scheduler::frame_budget_{
+    Render_scheduler::Period_t{16}};
+
+}  // namespace detail
+}  // namespace cppurses
@@ -5,7 +5,6 @@
 #include <memory>
 #include <mutex>
 #include <stdexcept>
-#include <thread>
 #include <utility>
 #include <vector>
 
@@ -14,16 +13,25 @@
 #include <cppurses/painter/palette.hpp>
 #include <cppurses/system/animation_engine.hpp>
 #include <cppurses/system/detail/event_queue.hpp>
+#include <cppurses/system/detail/hit_map.hpp>
 #include <cppurses/system/detail/is_sendable.hpp>
 #include <cppurses/system/detail/user_input_event_loop.hpp>
 #include <cppurses/system/event.hpp>
 #include <cppurses/system/event_loop.hpp>
 #include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/focus.hpp>
 #include <cppurses/system/system.hpp>
 #include <cppurses/terminal/terminal.hpp>
 #include <cppurses/widget/area.hpp>
 #include <cppurses/widget/widget.hpp>
 
+namespace {
+
+/// The Event_loop running on this thread, nullptr if there is none.
+thread_local cppurses::Event_loop* current_loop{nullptr};
+
+}  // namespace
+
 namespace cppurses {
 
 sig::Slot<void()> System::quit = []() { System::exit(); };
@@ -36,8 +44,19 @@ Animation_engine System::animation_engine_;
 Terminal System::terminal;
 
 void System::post_event(std::unique_ptr<Event> event) {
-    auto& loop = System::find_event_loop();
-    loop.event_queue_.append(std::move(event));
+    if (current_loop != nullptr) {
+        current_loop->event_queue_.append(std::move(event));
+    } else {
+        main_loop_.post_event(std::move(event));
+    }
+}
+
+void System::post_event(Event_loop& loop, std::unique_ptr<Event> event) {
+    loop.post_event(std::move(event));
+}
+
+Event_loop& System::main_event_loop() {
+    return main_loop_;
 }
 
 bool System::send_event(const Event& event) {
@@ -61,22 +80,25 @@ void System::exit(int return_code) {
 }
 
 Event_loop& System::find_event_loop() {
-    std::lock_guard<std::mutex> lock{running_loops_mtx_};
-    std::thread::id id{std::this_thread::get_id()};
-    for (Event_loop* loop : running_event_loops_) {
-        if (loop->get_thread_id() == id) {
-            return *loop;
-        }
-    }
-    return main_loop_;
+    return current_loop != nullptr ? *current_loop : main_loop_;
 }
 
 void System::register_event_loop(Event_loop* loop) {
+    current_loop = loop;
     std::lock_guard<std::mutex> lock{running_loops_mtx_};
     running_event_loops_.push_back(loop);
 }
 
+void System::discard_events(const Widget& receiver) {
+    if (current_loop != nullptr) {
+        current_loop->discard_events(receiver);
+    }
+}
+
 void System::deregister_event_loop(Event_loop* loop) {
+    if (current_loop == loop) {
+        current_loop = nullptr;
+    }
     std::lock_guard<std::mutex> lock{running_loops_mtx_};
     auto iter = std::find(std::begin(running_event_loops_),
                           std::end(running_event_loops_), loop);
@@ -94,6 +116,8 @@ void System::set_head(Widget* new_head) {
         head_->disable();
     }
     head_ = new_head;
+    detail::Hit_map::invalidate_all();
+    Focus::reset_chain();
     if (head_ != nullptr) {
         head_->enable();
         post_event<Resize_event>(*head_,
@@ -1,13 +1,16 @@
 #include <cppurses/system/detail/timer_event_loop.hpp>
 
 #include <chrono>
-#include <iterator>
-#include <set>
-#include <thread>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <utility>
+#include <vector>
 
+#include <signals/connection.hpp>
 #include <signals/signals.hpp>
 
+#include <cppurses/system/event.hpp>
 #include <cppurses/system/event_loop.hpp>
 #include <cppurses/system/events/timer_event.hpp>
 #include <cppurses/system/system.hpp>
@@ -16,22 +19,90 @@
 namespace cppurses {
 namespace detail {
 
-void Timer_event_loop::register_widget(Widget& w) {
-    registered_widgets_.emplace(&w);
-    w.destroyed.connect([this](Widget& d) { registered_widgets_.erase(&d); });
+void Timer_event_loop::register_widget(Widget& w,
+                                       std::function<Period_t()> period_func) {
+    std::unique_lock<std::mutex> lock{state_->mtx};
+    const auto id = state_->next_id++;
+    const auto first = Clock_t::now() + period_func();
+    auto found = state_->registrations.find(&w);
+    if (found != std::end(state_->registrations)) {
+        found->second.id = id;
+        found->second.period_func = std::move(period_func);
+    } else {
+        auto state = std::weak_ptr<Shared_state>{state_};
+        auto on_destroyed = w.destroyed.connect([state](Widget& d) {
+            if (auto shared = state.lock()) {
+                std::lock_guard<std::mutex> lock{shared->mtx};
+                shared->registrations.erase(&d);
+            }
+        });
+        state_->registrations.emplace(
+            &w, Registration{id, std::move(period_func), on_destroyed});
+    }
+    state_->deadlines.push(Deadline{first, &w, id});
+    lock.unlock();
+    // The new deadline might be earlier than the one being slept until.
+    this->wake_up();
+}
+
+bool Timer_event_loop::unregister_widget(Widget& w) {
+    std::lock_guard<std::mutex> lock{state_->mtx};
+    auto found = state_->registrations.find(&w);
+    if (found == std::end(state_->registrations)) {
+        return false;
+    }
+    found->second.on_destroyed.disconnect();
+    state_->registrations.erase(found);
+    return true;
+}
+
+bool Timer_event_loop::empty() const {
+    std::lock_guard<std::mutex> lock{state_->mtx};
+    return state_->registrations.empty();
 }
 
 void Timer_event_loop::loop_function() {
-    for (Widget* widg : registered_widgets_) {
-        System::post_event<Timer_event>(*widg);
+    std::unique_lock<std::mutex> lock{state_->mtx};
+    auto& deadlines = state_->deadlines;
+    auto due = std::vector<std::unique_ptr<Event>>{};
+    const auto now = Clock_t::now();
+    while (!deadlines.empty() && deadlines.top().when <= now) {
+        auto deadline = deadlines.top();
+        deadlines.pop();
+        auto found = state_->registrations.find(deadline.widget);
+        if (found == std::end(state_->registrations) ||
+            found->second.id != deadline.id) {
+            continue;  // Unregistered or registered again since.
+        }
+        due.push_back(std::make_unique<Timer_event>(*deadline.widget));
+        const auto period = found->second.period_func();
+        deadline.when += period;
+        if (deadline.when <= now) {
+            deadline.when = now + period;
+        }
+        deadlines.push(deadline);
+    }
+    if (!due.empty()) {
+        System::main_event_loop().post_events(std::move(due));
+    }
+    const auto woken = [this] { return state_->woken; };
+    if (deadlines.empty()) {
+        state_->woken_cv.wait(lock, woken);
+    } else {
+        state_->woken_cv.wait_until(lock, deadlines.top().when, woken);
+    }
+    state_->woken = false;
+}
+
+void Timer_event_loop::wake_up() {
+    if (state_ == nullptr) {  // Moved from.
+        return;
     }
-    auto now = std::chrono::high_resolution_clock::now();
-    auto time_passed = now - last_time_;
-    auto time_to_sleep = period_func_() - time_passed;
-    if (time_to_sleep > Period_t::zero()) {
-        std::this_thread::sleep_for(time_to_sleep);
+    {
+        std::lock_guard<std::mutex> lock{state_->mtx};
+        state_->woken = true;
     }
-    last_time_ = std::chrono::high_resolution_clock::now();
+    state_->woken_cv.notify_one();
 }
 
 }  // namespace detail
@@ -0,0 +1,655 @@
+#include <cppurses/system/tracer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cppurses/system/detail/event_as_string.hpp>
+#include <cppurses/system/event.hpp>
+#include <cppurses/widget/widget.hpp>
+
+namespace {
+using namespace cppurses;
+using Clock_t = Tracer::Clock_t;
+using Histogram = Tracer::Histogram;
+
+const std::size_t type_count{Event::Custom + 1};
+const std::size_t metric_count{2};
+const std::size_t phase_count{2};
+
+/// Spans kept per thread for the Chrome trace, later spans are dropped.
+const std::size_t max_spans{1 << 16};
+
+/// Chrome trace timestamps are in microseconds from this time.
+const auto trace_epoch = Clock_t::now();
+
+std::uint64_t to_us(Clock_t::duration duration) {
+    const auto us =
+        std::chrono::duration_cast<std::chrono::microseconds>(duration);
+    return us.count() < 0 ? 0 : static_cast<std::uint64_t>(us.count());
+}
+
+std::size_t index(Tracer::Metric metric) {
+    return static_cast<std::size_t>(metric);
+}
+
+std::size_t index(Tracer::Phase phase) {
+    return static_cast<std::size_t>(phase);
+}
+
+/// A Histogram written by a single thread and read from any thread.
+struct Atomic_histogram {
+    std::array<std::atomic<std::uint64_t>, Histogram::bucket_count> buckets{};
+    std::atomic<std::uint64_t> total_us{0};
+    std::atomic<std::uint64_t> max_us{0};
+
+    /// Only called by the owning thread, so a load and a store are enough.
+    void record(std::uint64_t us) {
+        const auto relaxed = std::memory_order_relaxed;
+        auto& bucket = buckets[Histogram::bucket_for(us)];
+        bucket.store(bucket.load(relaxed) + 1, relaxed);
+        total_us.store(total_us.load(relaxed) + us, relaxed);
+        if (us > max_us.load(relaxed)) {
+            max_us.store(us, relaxed);
+        }
+    }
+
+    void add_to(Histogram& histogram) const {
+        const auto relaxed = std::memory_order_relaxed;
+        for (std::size_t i{0}; i < buckets.size(); ++i) {
+            histogram.buckets[i] += buckets[i].load(relaxed);
+        }
+        histogram.total_us += total_us.load(relaxed);
+        histogram.max_us = std::max(histogram.max_us, max_us.load(relaxed));
+    }
+
+    void clear() {
+        for (auto& bucket : buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        total_us.store(0, std::memory_order_relaxed);
+        max_us.store(0, std::memory_order_relaxed);
+    }
+};
+
+/// Counts of one Event::Type sent to one Widget.
+using Type_counts = std::array<Atomic_histogram, metric_count>;
+
+/// Counts for one Widget on one thread, written only by that thread.
+struct Widget_record {
+    /// Set before the record is added to the map, never changed after.
+    std::string name;
+    /// Tells apart records of Widgets that had the same address.
+    std::uint64_t serial;
+    /// Allocated the first time an Event of the type is sent to the Widget,
+    /// with the lock held as for adding a Widget.
+    std::array<std::unique_ptr<Type_counts>, type_count> types;
+
+    /// Adds the counts of \p metric for Events of every type to \p total.
+    void add_to(Histogram& total, Tracer::Metric metric) const {
+        for (const auto& counts : types) {
+            if (counts != nullptr) {
+                (*counts)[index(metric)].add_to(total);
+            }
+        }
+    }
+};
+
+/// A timed Event or frame Phase, for the Chrome trace.
+struct Span {
+    std::string name;
+    const char* category;
+    std::string widget;
+    std::uint64_t start_us;
+    std::uint64_t duration_us;
+};
+
+/// Everything recorded by one thread.
+struct Thread_record {
+    std::size_t thread_index{0};
+    std::thread::id owner;
+    std::array<std::array<Atomic_histogram, metric_count>, type_count> events;
+    std::array<Atomic_histogram, phase_count> frames;
+
+    /// Only the owning thread changes the map, it reads the map and updates
+    /// the counts without a lock. It locks widgets_mtx to change the map or
+    /// to allocate Type_counts, other threads lock it to read. Once the
+    /// owning thread has exited, any thread holding the lock can change it.
+    std::mutex widgets_mtx;
+    std::unordered_map<const Widget*, Widget_record> widgets;
+    std::uint64_t next_serial{0};
+
+    /// Guarded by widgets_mtx, false once the owning thread has exited.
+    bool alive{true};
+
+    /// Changes requested by other threads, applied by the owning thread.
+    /** Guarded by widgets_mtx, pending is set while there are any. */
+    std::vector<const Widget*> forgotten;
+    bool clear_requested{false};
+    std::atomic<bool> pending{false};
+
+    std::mutex spans_mtx;
+    std::vector<Span> spans;
+
+    void add_span(Span span) {
+        std::lock_guard<std::mutex> lock{spans_mtx};
+        if (spans.size() < max_spans) {
+            spans.push_back(std::move(span));
+        }
+    }
+};
+
+/// Records of every thread that has recorded, kept after threads exit.
+/** Never destroyed, Widgets with static storage are forgotten after main(). */
+std::mutex& registry_mtx{*new std::mutex};
+std::vector<std::shared_ptr<Thread_record>>& registry{
+    *new std::vector<std::shared_ptr<Thread_record>>};
+
+/// Owns the calling thread's Thread_record, marks it as orphaned on exit.
+struct Record_owner {
+    std::shared_ptr<Thread_record> record{std::make_shared<Thread_record>()};
+
+    Record_owner() {
+        record->owner = std::this_thread::get_id();
+        std::lock_guard<std::mutex> lock{registry_mtx};
+        record->thread_index = registry.size();
+        registry.push_back(record);
+    }
+
+    ~Record_owner() {
+        std::lock_guard<std::mutex> lock{record->widgets_mtx};
+        record->alive = false;
+    }
+};
+
+Thread_record& this_thread_record() {
+    thread_local Record_owner owner;
+    return *owner.record;
+}
+
+/// True if the map of \p record can be changed by the calling thread.
+/** widgets_mtx must be held. */
+bool can_change(const Thread_record& record) {
+    return !record.alive || record.owner == std::this_thread::get_id();
+}
+
+/// True if \p w has been destroyed, but not yet erased by the owning thread.
+/** widgets_mtx must be held. */
+bool is_forgotten(const Thread_record& record, const Widget* w) {
+    return std::find(std::begin(record.forgotten), std::end(record.forgotten),
+                     w) != std::end(record.forgotten);
+}
+
+/// Applies the changes other threads requested, called by the owning thread.
+void apply_pending(Thread_record& record) {
+    if (!record.pending.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock{record.widgets_mtx};
+    if (record.clear_requested) {
+        record.widgets.clear();
+        record.clear_requested = false;
+    }
+    for (const Widget* w : record.forgotten) {
+        record.widgets.erase(w);
+    }
+    record.forgotten.clear();
+    record.pending.store(false, std::memory_order_relaxed);
+}
+
+template <typename Function>
+void for_each_record(Function&& f) {
+    std::lock_guard<std::mutex> lock{registry_mtx};
+    for (const auto& record : registry) {
+        f(*record);
+    }
+}
+
+void write_row(std::ostream& os,
+               const std::string& name,
+               const std::string& metric,
+               const Histogram& histogram) {
+    os << "  " << std::left << std::setw(24) << name << std::setw(12)
+       << metric << std::right << std::setw(10) << histogram.count()
+       << std::setw(10) << static_cast<std::uint64_t>(histogram.mean_us())
+       << std::setw(10) << histogram.percentile_us(0.5) << std::setw(10)
+       << histogram.percentile_us(0.99) << std::setw(10) << histogram.max_us
+       << '\n';
+}
+
+void write_header(std::ostream& os, const std::string& title) {
+    os << title << '\n'
+       << "  " << std::left << std::setw(24) << "" << std::setw(12) << ""
+       << std::right << std::setw(10) << "count" << std::setw(10) << "mean us"
+       << std::setw(10) << "p50 us" << std::setw(10) << "p99 us"
+       << std::setw(10) << "max us" << '\n';
+}
+
+const char* metric_name(Tracer::Metric metric) {
+    return metric == Tracer::Metric::Handler ? "handler" : "queue wait";
+}
+
+const char* phase_name(Tracer::Phase phase) {
+    return phase == Tracer::Phase::Paint ? "Paint" : "Flush";
+}
+
+std::string json_escaped(const std::string& text) {
+    auto escaped = std::string{};
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped.push_back('\\');
+            escaped.push_back(c);
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            escaped.push_back(' ');
+        } else {
+            escaped.push_back(c);
+        }
+    }
+    return escaped;
+}
+
+}  // namespace
+
+namespace cppurses {
+
+constexpr std::size_t Tracer::Histogram::bucket_count;
+std::atomic<bool> Tracer::enabled_{false};
+std::atomic<bool> Tracer::chrome_trace_{false};
+
+std::uint64_t Tracer::Histogram::count() const {
+    auto sum = std::uint64_t{0};
+    for (auto bucket : buckets) {
+        sum += bucket;
+    }
+    return sum;
+}
+
+double Tracer::Histogram::mean_us() const {
+    const auto n = this->count();
+    return n == 0 ? 0.0 : static_cast<double>(total_us) / n;
+}
+
+std::uint64_t Tracer::Histogram::percentile_us(double p) const {
+    const auto n = this->count();
+    if (n == 0) {
+        return 0;
+    }
+    const auto rank = static_cast<std::uint64_t>(p * (n - 1)) + 1;
+    auto seen = std::uint64_t{0};
+    for (std::size_t i{0}; i < bucket_count; ++i) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            const auto upper_edge = std::uint64_t{1} << i;
+            return std::min(upper_edge, max_us);
+        }
+    }
+    return max_us;
+}
+
+Tracer::Histogram& Tracer::Histogram::operator+=(const Histogram& other) {
+    for (std::size_t i{0}; i < bucket_count; ++i) {
+        buckets[i] += other.buckets[i];
+    }
+    total_us += other.total_us;
+    max_us = std::max(max_us, other.max_us);
+    return *this;
+}
+
+std::size_t Tracer::Histogram::bucket_for(std::uint64_t us) {
+    auto bucket = std::size_t{0};
+    while (us != 0 && bucket + 1 < bucket_count) {
+        us >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+void Tracer::enable(bool enable) {
+    enabled_.store(enable, std::memory_order_relaxed);
+}
+
+void Tracer::reset() {
+    for_each_record([](Thread_record& record) {
+        for (auto& metrics : record.events) {
+            for (auto& histogram : metrics) {
+                histogram.clear();
+            }
+        }
+        for (auto& histogram : record.frames) {
+            histogram.clear();
+        }
+        {
+            std::lock_guard<std::mutex> lock{record.widgets_mtx};
+            if (can_change(record)) {
+                record.widgets.clear();
+            } else {
+                record.clear_requested = true;
+                record.forgotten.clear();
+                record.pending.store(true, std::memory_order_release);
+            }
+        }
+        std::lock_guard<std::mutex> lock{record.spans_mtx};
+        record.spans.clear();
+    });
+}
+
+Tracer::Histogram Tracer::event_histogram(Event::Type type, Metric metric) {
+    auto histogram = Histogram{};
+    for_each_record([&](const Thread_record& record) {
+        record.events[type][index(metric)].add_to(histogram);
+    });
+    return histogram;
+}
+
+Tracer::Histogram Tracer::widget_histogram(const Widget& w, Metric metric) {
+    auto histogram = Histogram{};
+    for_each_record([&](Thread_record& record) {
+        std::lock_guard<std::mutex> lock{record.widgets_mtx};
+        if (record.clear_requested) {
+            return;
+        }
+        const auto found = record.widgets.find(&w);
+        if (found != std::end(record.widgets) && !is_forgotten(record, &w)) {
+            found->second.add_to(histogram, metric);
+        }
+    });
+    return histogram;
+}
+
+Tracer::Histogram Tracer::widget_histogram(const Widget& w,
+                                           Event::Type type,
+                                           Metric metric) {
+    auto histogram = Histogram{};
+    for_each_record([&](Thread_record& record) {
+        std::lock_guard<std::mutex> lock{record.widgets_mtx};
+        if (record.clear_requested) {
+            return;
+        }
+        const auto found = record.widgets.find(&w);
+        if (found == std::end(record.widgets) || is_forgotten(record, &w)) {
+            return;
+        }
+        const auto& counts = found->second.types[type];
+        if (counts != nullptr) {
+            (*counts)[index(metric)].add_to(histogram);
+        }
+    });
+    return histogram;
+}
+
+void Tracer::forget(const Widget& w) {
+    for_each_record([&w](Thread_record& record) {
+        std::lock_guard<std::mutex> lock{record.widgets_mtx};
+        const auto found = record.widgets.find(&w);
+        if (found == std::end(record.widgets)) {
+            return;
+        }
+        if (can_change(record)) {
+            record.widgets.erase(found);
+        } else {
+            record.forgotten.push_back(&w);
+            record.pending.store(true, std::memory_order_release);
+        }
+    });
+}
+
+Tracer::Histogram Tracer::frame_histogram(Phase phase) {
+    auto histogram = Histogram{};
+    for_each_record([&](const Thread_record& record) {
+        record.frames[index(phase)].add_to(histogram);
+    });
+    return histogram;
+}
+
+std::vector<Tracer::Widget_cost> Tracer::widget_costs() {
+    auto costs = std::vector<Widget_cost>{};
+    auto positions = std::unordered_map<const Widget*, std::size_t>{};
+    for_each_record([&](Thread_record& record) {
+        std::lock_guard<std::mutex> lock{record.widgets_mtx};
+        if (record.clear_requested) {
+            return;
+        }
+        for (const auto& entry : record.widgets) {
+            if (is_forgotten(record, entry.first)) {
+                continue;
+            }
+            auto handler = Histogram{};
+            entry.second.add_to(handler, Metric::Handler);
+            auto paint_us = std::uint64_t{0};
+            const auto& paint = entry.second.types[Event::Paint];
+            if (paint != nullptr) {
+                paint_us = (*paint)[index(Metric::Handler)].total_us.load(
+                    std::memory_order_relaxed);
+            }
+            const auto found = positions.find(entry.first);
+            if (found != std::end(positions)) {
+                costs[found->second].handler_us += handler.total_us;
+                costs[found->second].paint_us += paint_us;
+                continue;
+            }
+            positions.emplace(entry.first, costs.size());
+            costs.push_back(Widget_cost{entry.first, entry.second.name,
+                                        handler.total_us, paint_us});
+        }
+    });
+    return costs;
+}
+
+void Tracer::dump(std::ostream& os) {
+    const Metric metrics[] = {Metric::Handler, Metric::Queue_wait};
+    write_header(os, "Events by type");
+    for (std::size_t type{0}; type < type_count; ++type) {
+        for (Metric metric : metrics) {
+            const auto histogram =
+                event_histogram(static_cast<Event::Type>(type), metric);
+            if (histogram.count() != 0) {
+                write_row(os,
+                          detail::event_type_as_string(
+                              static_cast<Event::Type>(type)),
+                          metric_name(metric), histogram);
+            }
+        }
+    }
+
+    // Merge each thread's Widget counts, then sort by total handler time.
+    struct Merged {
+        std::string name;
+        std::uint64_t handler_us{0};
+        std::array<std::unique_ptr<std::array<Histogram, metric_count>>,
+                   type_count>
+            types;
+    };
+    auto widgets = std::unordered_map<const Widget*, Merged>{};
+    for_each_record([&widgets](Thread_record& record) {
+        std::lock_guard<std::mutex> lock{record.widgets_mtx};
+        if (record.clear_requested) {
+            return;
+        }
+        for (const auto& entry : record.widgets) {
+            if (is_forgotten(record, entry.first)) {
+                continue;
+            }
+            auto& merged = widgets[entry.first];
+            merged.name = entry.second.name;
+            for (std::size_t type{0}; type < type_count; ++type) {
+                const auto& counts = entry.second.types[type];
+                if (counts == nullptr) {
+                    continue;
+                }
+                auto& merged_type = merged.types[type];
+                if (merged_type == nullptr) {
+                    merged_type =
+                        std::make_unique<std::array<Histogram, metric_count>>();
+                }
+                for (std::size_t i{0}; i < metric_count; ++i) {
+                    (*counts)[i].add_to((*merged_type)[i]);
+                }
+                merged.handler_us +=
+                    (*counts)[index(Metric::Handler)].total_us.load(
+                        std::memory_order_relaxed);
+            }
+        }
+    });
+    auto sorted = std::vector<const Merged*>{};
+    for (const auto& entry : widgets) {
+        sorted.push_back(&entry.second);
+    }
+    std::sort(std::begin(sorted), std::end(sorted),
+              [](const Merged* a, const Merged* b) {
+                  return a->handler_us > b->handler_us;
+              });
+    write_header(os, "Widgets by handler time");
+    for (const Merged* widget : sorted) {
+        os << "  " << (widget->name.empty() ? "(unnamed)" : widget->name)
+           << '\n';
+        for (std::size_t type{0}; type < type_count; ++type) {
+            if (widget->types[type] == nullptr) {
+                continue;
+            }
+            const auto type_name = std::string{"  "} +
+                                   detail::event_type_as_string(
+                                       static_cast<Event::Type>(type));
+            for (Metric metric : metrics) {
+                const auto& histogram = (*widget->types[type])[index(metric)];
+                if (histogram.count() != 0) {
+                    write_row(os, type_name, metric_name(metric), histogram);
+                }
+            }
+        }
+    }
+
+    write_header(os, "Frames");
+    for (Phase phase : {Phase::Paint, Phase::Flush}) {
+        const auto histogram = frame_histogram(phase);
+        if (histogram.count() != 0) {
+            write_row(os, phase_name(phase), "", histogram);
+        }
+    }
+}
+
+void Tracer::enable_chrome_trace(bool enable) {
+    chrome_trace_.store(enable, std::memory_order_relaxed);
+}
+
+void Tracer::write_chrome_trace(std::ostream& os) {
+    os << "{\"traceEvents\":[";
+    auto separator = "\n";
+    for_each_record([&](Thread_record& record) {
+        auto spans = std::vector<Span>{};
+        {
+            std::lock_guard<std::mutex> lock{record.spans_mtx};
+            spans.swap(record.spans);
+        }
+        for (const Span& span : spans) {
+            os << separator << "{\"name\":\"" << json_escaped(span.name)
+               << "\",\"cat\":\"" << span.category
+               << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << record.thread_index
+               << ",\"ts\":" << span.start_us
+               << ",\"dur\":" << span.duration_us;
+            if (!span.widget.empty()) {
+                os << ",\"args\":{\"widget\":\"" << json_escaped(span.widget)
+                   << "\"}";
+            }
+            os << '}';
+            separator = ",\n";
+        }
+    });
+    os << "\n]}\n";
+}
+
+Tracer::Event_scope::Event_scope(const Event& event)
+    : active_{Tracer::enabled()}, type_{event.type()} {
+    if (!active_) {
+        return;
+    }
+    queued_ = event.queued_time();
+    auto& record = this_thread_record();
+    // A Widget forgotten by another thread could share an address with this
+    // receiver, it is erased first.
+    apply_pending(record);
+    receiver_ = &event.receiver();
+    auto found = record.widgets.find(receiver_);
+    if (found == std::end(record.widgets) ||
+        found->second.types[type_] == nullptr) {
+        // Readers hold the lock, so the map is not changed under them.
+        std::lock_guard<std::mutex> lock{record.widgets_mtx};
+        if (found == std::end(record.widgets)) {
+            found = record.widgets.emplace(std::piecewise_construct,
+                                           std::forward_as_tuple(receiver_),
+                                           std::forward_as_tuple())
+                        .first;
+            found->second.name = receiver_->name();
+            found->second.serial = record.next_serial++;
+        }
+        found->second.types[type_] = std::make_unique<Type_counts>();
+    }
+    serial_ = found->second.serial;
+    start_ = Clock_t::now();
+}
+
+Tracer::Event_scope::~Event_scope() {
+    if (!active_) {
+        return;
+    }
+    const auto handler_us = to_us(Clock_t::now() - start_);
+    auto& record = this_thread_record();
+    auto& counts = record.events[type_];
+    counts[index(Metric::Handler)].record(handler_us);
+    const auto was_queued = queued_ != Clock_t::time_point{};
+    const auto wait_us = was_queued ? to_us(start_ - queued_) : 0;
+    if (was_queued) {
+        counts[index(Metric::Queue_wait)].record(wait_us);
+    }
+    // The receiver might have been destroyed and forgotten while handling.
+    const auto found = record.widgets.find(receiver_);
+    const auto alive = found != std::end(record.widgets) &&
+                       found->second.serial == serial_;
+    if (alive) {
+        auto& metrics = *found->second.types[type_];
+        metrics[index(Metric::Handler)].record(handler_us);
+        if (was_queued) {
+            metrics[index(Metric::Queue_wait)].record(wait_us);
+        }
+    }
+    if (chrome_trace_.load(std::memory_order_relaxed)) {
+        record.add_span(Span{detail::event_type_as_string(type_), "event",
+                             alive ? found->second.name : std::string{},
+                             to_us(start_ - trace_epoch), handler_us});
+    }
+}
+
+Tracer::Frame_scope::Frame_scope(Phase phase)
+    : active_{Tracer::enabled()}, phase_{phase} {
+    if (active_) {
+        start_ = Clock_t::now();
+    }
+}
+
+Tracer::Frame_scope::~Frame_scope() {
+    if (!active_) {
+        return;
+    }
+    const auto duration_us = to_us(Clock_t::now() - start_);
+    auto& record = this_thread_record();
+    record.frames[index(phase_)].record(duration_us);
+    if (chrome_trace_.load(std::memory_order_relaxed)) {
+        record.add_span(Span{phase_name(phase_), "frame", std::string{},
+                             to_us(start_ - trace_epoch), duration_us});
+    }
+}
+
+}  // namespace cppurses
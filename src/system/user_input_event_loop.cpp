@@ -5,16 +5,25 @@
 
 #include <cppurses/system/event.hpp>
 #include <cppurses/system/system.hpp>
-#include <cppurses/terminal/input.hpp>
 
 namespace cppurses {
 namespace detail {
 
+void User_input_event_loop::wake_up() {
+    reactor_.wake_up();
+}
+
 void User_input_event_loop::loop_function() {
-    auto event = input::get();
-    if (event != nullptr) {
+    // A deferred frame is flushed once due, even if no input arrives.
+    auto events = reactor_.wait(this->pending_frame_timeout());
+    if (events.empty()) {
+        return;
+    }
+    for (auto& event : events) {
         System::post_event(std::move(event));
     }
+    // Input should be responded to without delay.
+    this->request_immediate_frame();
 }
 
 }  // namespace detail
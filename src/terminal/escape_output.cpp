@@ -0,0 +1,241 @@
+#include <cppurses/terminal/detail/escape_output.hpp>
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <ncurses.h>
+#include <unistd.h>
+#include <wchar.h>
+
+#include <optional/optional.hpp>
+
+#include <cppurses/painter/attribute.hpp>
+#include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/color.hpp>
+#include <cppurses/painter/glyph.hpp>
+
+namespace {
+using namespace cppurses;
+
+const char begin_synchronized_update[] = "\x1b[?2026h";
+const char end_synchronized_update[] = "\x1b[?2026l";
+const char reset_attributes[] = "\x1b[0m";
+const char show_cursor[] = "\x1b[?25h";
+
+/// Returns the SGR parameter for \p attr.
+const char* sgr_parameter(Attribute attr) {
+    switch (attr) {
+        case Attribute::Bold:
+            return "1";
+        case Attribute::Dim:
+            return "2";
+        case Attribute::Italic:
+            return "3";
+        case Attribute::Underline:
+            return "4";
+        case Attribute::Blink:
+            return "5";
+        case Attribute::Standout:
+        case Attribute::Inverse:
+            return "7";
+        case Attribute::Invisible:
+            return "8";
+    }
+    return "0";
+}
+
+/// SGR parameter fragments, indexed by the packed parts of a Brush.
+struct Sgr_table {
+    std::array<std::string, 256> attributes;
+    std::array<std::string, Brush::color_code_count> foregrounds;
+    std::array<std::string, Brush::color_code_count> backgrounds;
+};
+
+Sgr_table make_sgr_table() {
+    auto table = Sgr_table{};
+    for (auto mask = std::size_t{0}; mask < table.attributes.size(); ++mask) {
+        for (Attribute a : Attribute_list) {
+            if ((mask & (std::size_t{1} << static_cast<int>(a))) != 0) {
+                table.attributes[mask].push_back(';');
+                table.attributes[mask].append(sgr_parameter(a));
+            }
+        }
+    }
+    // No color is displayed as Black.
+    for (auto code = std::size_t{0}; code < Brush::color_code_count; ++code) {
+        const auto value = std::to_string(
+            detail::first_color_value + (code == 0 ? 0 : code - 1));
+        table.foregrounds[code] = ";38;5;" + value;
+        table.backgrounds[code] = ";48;5;" + value;
+    }
+    return table;
+}
+
+const Sgr_table& sgr_table() {
+    static const auto table = make_sgr_table();
+    return table;
+}
+
+/// Writes the entire contents of \p data to stdout, retrying on interrupts.
+void write_all(const char* data, std::size_t size) {
+    while (size > 0) {
+        const auto written = ::write(STDOUT_FILENO, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+Escape_output::Escape_output() {
+    buffer_.reserve(1 << 16);
+}
+
+void Escape_output::put(std::size_t x,
+                        std::size_t y,
+                        const Glyph* glyphs,
+                        std::size_t count) {
+    if (count == 0) {
+        return;
+    }
+    if (buffer_.empty()) {
+        buffer_.append(begin_synchronized_update);
+    }
+    this->move_cursor(x, y);
+    this->set_brush(glyphs[0].brush);
+    auto single_width = true;
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        this->append_symbol(glyphs[i].symbol);
+        single_width = single_width && ::wcwidth(glyphs[i].symbol) == 1;
+    }
+    cursor_x_ = x + count;
+    cursor_known_ = single_width;
+}
+
+void Escape_output::scroll_rows(std::size_t top,
+                                std::size_t bottom,
+                                std::ptrdiff_t lines) {
+    if (buffer_.empty()) {
+        buffer_.append(begin_synchronized_update);
+    }
+    // Set scrolling region, scroll up(SU) or down(SD), reset scrolling region.
+    buffer_.append("\x1b[");
+    this->append_number(top + 1);
+    buffer_.push_back(';');
+    this->append_number(bottom);
+    buffer_.append("r\x1b[");
+    this->append_number(static_cast<std::size_t>(lines < 0 ? -lines : lines));
+    buffer_.push_back(lines < 0 ? 'T' : 'S');
+    buffer_.append("\x1b[r");
+    // Setting the scrolling region moves the cursor to the home position.
+    cursor_known_ = false;
+}
+
+void Escape_output::show_cursor_at(std::size_t x, std::size_t y) {
+    shown_cursor_x_ = x;
+    shown_cursor_y_ = y;
+    shows_cursor_ = true;
+}
+
+void Escape_output::flush() {
+    if (buffer_.empty() && !shows_cursor_) {
+        return;
+    }
+    if (buffer_.empty()) {
+        buffer_.append(begin_synchronized_update);
+    }
+    buffer_.append(reset_attributes);
+    brush_known_ = false;
+    cursor_known_ = false;
+    if (shows_cursor_) {
+        this->move_cursor(shown_cursor_x_, shown_cursor_y_);
+        buffer_.append(show_cursor);
+        shows_cursor_ = false;
+    } else {
+        // Leave the terminal in the state ncurses expects it to be in.
+        int y{0};
+        int x{0};
+        getyx(::curscr, y, x);
+        this->move_cursor(x, y);
+    }
+    buffer_.append(end_synchronized_update);
+    write_all(buffer_.data(), buffer_.size());
+    bytes_written_ += buffer_.size();
+    buffer_.clear();
+    // ncurses may move the cursor before the next frame.
+    cursor_known_ = false;
+}
+
+void Escape_output::move_cursor(std::size_t x, std::size_t y) {
+    if (cursor_known_ && cursor_x_ == x && cursor_y_ == y) {
+        return;
+    }
+    buffer_.append("\x1b[");
+    this->append_number(y + 1);
+    buffer_.push_back(';');
+    this->append_number(x + 1);
+    buffer_.push_back('H');
+    cursor_x_ = x;
+    cursor_y_ = y;
+    cursor_known_ = true;
+}
+
+void Escape_output::set_brush(const Brush& b) {
+    if (brush_known_ && brush_ == b) {
+        return;
+    }
+    const auto& table = sgr_table();
+    buffer_.append("\x1b[0");
+    buffer_.append(table.attributes[b.attribute_mask()]);
+    buffer_.append(table.foregrounds[b.foreground_code()]);
+    buffer_.append(table.backgrounds[b.background_code()]);
+    buffer_.push_back('m');
+    brush_ = b;
+    brush_known_ = true;
+}
+
+void Escape_output::append_symbol(wchar_t symbol) {
+    const auto code = static_cast<std::uint32_t>(symbol);
+    if (code < 0x80) {
+        buffer_.push_back(static_cast<char>(code));
+    } else if (code < 0x800) {
+        buffer_.push_back(static_cast<char>(0xC0 | (code >> 6)));
+        buffer_.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    } else if (code < 0x10000) {
+        buffer_.push_back(static_cast<char>(0xE0 | (code >> 12)));
+        buffer_.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        buffer_.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    } else {
+        buffer_.push_back(static_cast<char>(0xF0 | (code >> 18)));
+        buffer_.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+        buffer_.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        buffer_.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+}
+
+void Escape_output::append_number(std::size_t value) {
+    char digits[20];
+    auto length = std::size_t{0};
+    do {
+        digits[length++] = static_cast<char>('0' + (value % 10));
+        value /= 10;
+    } while (value != 0);
+    while (length != 0) {
+        buffer_.push_back(digits[--length]);
+    }
+}
+
+}  // namespace detail
+}  // namespace cppurses
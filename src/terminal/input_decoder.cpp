@@ -0,0 +1,354 @@
+#include <cppurses/terminal/detail/input_decoder.hpp>
+
+#include <array>
+#include <cstddef>
+
+#include <cppurses/system/key.hpp>
+#include <cppurses/system/mouse_button.hpp>
+
+namespace {
+using namespace cppurses;
+using cppurses::detail::Decoded_input;
+
+const char escape{'\x1b'};
+
+/// Longer CSI sequences are not waited on, they are treated as garbage.
+const std::size_t max_sequence_length{32};
+
+/// Mouse report flag bits.
+const int motion_bit{32};
+const int wheel_bit{64};
+
+/// xterm modifier parameters, one plus the modifier bits.
+const int shift_modifier{2};
+const int ctrl_modifier{5};
+
+Decoded_input key_input(Key key) {
+    return Decoded_input{Decoded_input::Kind::Key, key, Mouse_button::None, 0,
+                         0};
+}
+
+Key byte_to_key(char byte) {
+    if (byte == '\r') {
+        return Key::Enter;
+    }
+    return static_cast<Key>(static_cast<unsigned char>(byte));
+}
+
+/// Returns Key::Function + \p n, shifted and ctrl versions as ncurses numbers
+/// them, F13 for shift + F1, F25 for ctrl + F1.
+Key function_key(int n, int modifier) {
+    if (modifier == shift_modifier) {
+        n += 12;
+    } else if (modifier == ctrl_modifier) {
+        n += 24;
+    }
+    return static_cast<Key>(static_cast<short>(Key::Function) + n);
+}
+
+/// The numeric parameters of a CSI sequence, separated by ';'.
+class Parameters {
+   public:
+    Parameters(const char* first, const char* last) {
+        auto value = 0;
+        auto has_value = false;
+        for (; first != last; ++first) {
+            if (*first >= '0' && *first <= '9') {
+                value = value * 10 + (*first - '0');
+                has_value = true;
+            } else if (*first == ';') {
+                this->push(value, has_value);
+                value = 0;
+                has_value = false;
+            }
+        }
+        this->push(value, has_value);
+    }
+
+    /// Returns parameter \p i, or \p default_value if it was not given.
+    int get(std::size_t i, int default_value) const {
+        if (i >= count_ || values_[i] == -1) {
+            return default_value;
+        }
+        return values_[i];
+    }
+
+   private:
+    std::array<int, 4> values_{};
+    std::size_t count_{0};
+
+    void push(int value, bool has_value) {
+        if (count_ < values_.size()) {
+            values_[count_++] = has_value ? value : -1;
+        }
+    }
+};
+
+/// Sets \p key from the final byte of a cursor or function key sequence.
+/** Returns false if \p final is not recognized. */
+bool final_to_key(char final, int modifier, Key& key) {
+    const auto shift = modifier == shift_modifier;
+    switch (final) {
+        case 'A':
+            // ncurses reports shift + up and down as the scroll keys.
+            key = shift ? Key::Scroll_backward : Key::Arrow_up;
+            break;
+        case 'B':
+            key = shift ? Key::Scroll_forward : Key::Arrow_down;
+            break;
+        case 'C':
+            key = shift ? Key::Shift_right_arrow : Key::Arrow_right;
+            break;
+        case 'D':
+            key = shift ? Key::Shift_left_arrow : Key::Arrow_left;
+            break;
+        case 'H':
+            key = shift ? Key::Shift_home : Key::Home;
+            break;
+        case 'F':
+            key = shift ? Key::Shift_end : Key::End;
+            break;
+        case 'E':
+            key = Key::Keypad_5;
+            break;
+        case 'Z':
+            key = Key::Back_tab;
+            break;
+        case 'P':
+        case 'Q':
+        case 'R':
+        case 'S':
+            key = function_key(final - 'P' + 1, modifier);
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+/// Sets \p key from the number in a "CSI number ~" sequence.
+/** Returns false if \p code is not recognized. */
+bool tilde_to_key(int code, int modifier, Key& key) {
+    const auto shift = modifier == shift_modifier;
+    switch (code) {
+        case 1:
+        case 7:
+            key = Key::Home;
+            break;
+        case 2:
+            key = Key::Insert_character;
+            break;
+        case 3:
+            key = shift ? Key::Shift_delete_character : Key::Delete_character;
+            break;
+        case 4:
+        case 8:
+            key = Key::End;
+            break;
+        case 5:
+            key = Key::Previous_page;
+            break;
+        case 6:
+            key = Key::Next_page;
+            break;
+        case 11:
+        case 12:
+        case 13:
+        case 14:
+        case 15:
+            key = function_key(code - 10, modifier);
+            break;
+        case 17:
+        case 18:
+        case 19:
+        case 20:
+        case 21:
+            key = function_key(code - 11, modifier);
+            break;
+        case 23:
+        case 24:
+            key = function_key(code - 12, modifier);
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+void Input_decoder::feed(const char* bytes, std::size_t count) {
+    buffer_.append(bytes, count);
+}
+
+bool Input_decoder::next(Decoded_input& input) {
+    while (read_pos_ < buffer_.size()) {
+        auto step = this->decode(input);
+        if (step.consumed == 0) {
+            if (!flushing_) {
+                buffer_.erase(0, read_pos_);
+                read_pos_ = 0;
+                return false;
+            }
+            // Waited long enough, the escape byte was not part of a sequence.
+            input = key_input(Key::Escape);
+            step = Step{1, true};
+        }
+        read_pos_ += step.consumed;
+        if (step.produced) {
+            return true;
+        }
+    }
+    buffer_.clear();
+    read_pos_ = 0;
+    flushing_ = false;
+    return false;
+}
+
+Input_decoder::Step Input_decoder::decode(Decoded_input& input) {
+    const char byte = buffer_[read_pos_];
+    if (byte != escape) {
+        input = key_input(byte_to_key(byte));
+        return Step{1, true};
+    }
+    if (read_pos_ + 1 == buffer_.size()) {
+        return Step{0, false};
+    }
+    switch (buffer_[read_pos_ + 1]) {
+        case '[':
+            return this->decode_csi(input);
+        case 'O':
+            return this->decode_ss3(input);
+        default:
+            // Alt + key is sent as escape then the key, as ncurses reports it.
+            input = key_input(Key::Escape);
+            return Step{1, true};
+    }
+}
+
+Input_decoder::Step Input_decoder::decode_csi(Decoded_input& input) {
+    const auto begin = read_pos_ + 2;
+    if (begin == buffer_.size()) {
+        return Step{0, false};
+    }
+    if (buffer_[begin] == 'M') {
+        return this->decode_x10_mouse(input);
+    }
+    // Parameter and intermediate bytes, up to the final byte.
+    auto end = begin;
+    while (end < buffer_.size() && buffer_[end] >= 0x20 &&
+           buffer_[end] <= 0x3F) {
+        ++end;
+    }
+    if (end == buffer_.size() && end - read_pos_ < max_sequence_length) {
+        return Step{0, false};
+    }
+    if (end == buffer_.size() || buffer_[end] < 0x40 || buffer_[end] > 0x7E) {
+        input = key_input(Key::Escape);
+        return Step{1, true};
+    }
+    const char final = buffer_[end];
+    const auto consumed = end + 1 - read_pos_;
+    const char* const data = buffer_.data();
+    if (buffer_[begin] == '<') {
+        if (final != 'M' && final != 'm') {
+            return Step{consumed, false};
+        }
+        const auto params = Parameters{data + begin + 1, data + end};
+        const auto produced =
+            this->decode_mouse(params.get(0, 0), params.get(1, 1) - 1,
+                               params.get(2, 1) - 1, final == 'm', input);
+        return Step{consumed, produced};
+    }
+    const auto params = Parameters{data + begin, data + end};
+    auto key = Key::Null;
+    const auto modifier = params.get(1, 1);
+    const auto found = final == '~'
+                           ? tilde_to_key(params.get(0, 0), modifier, key)
+                           : final_to_key(final, modifier, key);
+    if (found) {
+        input = key_input(key);
+    }
+    return Step{consumed, found};
+}
+
+Input_decoder::Step Input_decoder::decode_ss3(Decoded_input& input) {
+    if (read_pos_ + 2 == buffer_.size()) {
+        return Step{0, false};
+    }
+    const char final = buffer_[read_pos_ + 2];
+    auto key = Key::Null;
+    auto found = true;
+    if (final == 'M') {
+        key = Key::Enter;  // Keypad enter.
+    } else {
+        found = final_to_key(final, 1, key);
+    }
+    if (found) {
+        input = key_input(key);
+    }
+    return Step{3, found};
+}
+
+Input_decoder::Step Input_decoder::decode_x10_mouse(Decoded_input& input) {
+    const auto length = std::size_t{6};
+    if (buffer_.size() - read_pos_ < length) {
+        return Step{0, false};
+    }
+    const auto byte = [this](std::size_t i) {
+        return static_cast<int>(
+            static_cast<unsigned char>(buffer_[read_pos_ + i]));
+    };
+    const auto produced = this->decode_mouse(byte(3) - 32, byte(4) - 33,
+                                             byte(5) - 33, false, input);
+    return Step{length, produced};
+}
+
+bool Input_decoder::decode_mouse(int code,
+                                 int x,
+                                 int y,
+                                 bool release,
+                                 Decoded_input& input) {
+    if ((code & motion_bit) != 0) {
+        return false;
+    }
+    const auto low_bits = code & 3;
+    auto button = Mouse_button::None;
+    if ((code & wheel_bit) != 0) {
+        if (release) {
+            return false;
+        }
+        if (low_bits == 0) {
+            button = Mouse_button::ScrollUp;
+        } else if (low_bits == 1) {
+            button = Mouse_button::ScrollDown;
+        }
+    } else if (low_bits == 3) {
+        // X10 releases do not say which button was released.
+        button = last_pressed_;
+        release = true;
+    } else {
+        const Mouse_button buttons[] = {Mouse_button::Left,
+                                        Mouse_button::Middle,
+                                        Mouse_button::Right};
+        button = buttons[low_bits];
+        if (!release) {
+            last_pressed_ = button;
+        }
+    }
+    if (button == Mouse_button::None) {
+        return false;
+    }
+    const auto kind = release ? Decoded_input::Kind::Mouse_release
+                              : Decoded_input::Kind::Mouse_press;
+    input = Decoded_input{kind, Key::Null, button,
+                          static_cast<std::size_t>(x < 0 ? 0 : x),
+                          static_cast<std::size_t>(y < 0 ? 0 : y)};
+    return true;
+}
+
+}  // namespace detail
+}  // namespace cppurses
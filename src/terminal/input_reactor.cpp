@@ -0,0 +1,191 @@
+#include <cppurses/terminal/detail/input_reactor.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/signalfd.h>
+#include <unistd.h>
+
+#include <cppurses/system/detail/find_widget_at.hpp>
+#include <cppurses/system/event.hpp>
+#include <cppurses/system/events/key_event.hpp>
+#include <cppurses/system/events/mouse_event.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/events/terminal_resize_event.hpp>
+#include <cppurses/system/focus.hpp>
+#include <cppurses/system/key.hpp>
+#include <cppurses/system/mouse_data.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/terminal/detail/input_decoder.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/widget.hpp>
+
+namespace {
+using namespace cppurses;
+using cppurses::detail::Decoded_input;
+
+/// How long to wait for the rest of a sequence after an escape byte.
+const auto escape_delay = std::chrono::milliseconds{10};
+
+std::unique_ptr<Event> make_keyboard_event(Key key) {
+    Widget* const receiver = Focus::focus_widget();
+    return receiver != nullptr
+               ? std::make_unique<Key_press_event>(*receiver, key)
+               : nullptr;
+}
+
+std::unique_ptr<Event> make_mouse_event(const Decoded_input& input) {
+    Widget* receiver = detail::find_widget_at(input.x, input.y);
+    if (receiver == nullptr) {
+        return nullptr;
+    }
+    const auto global = Point{input.x, input.y};
+    const auto local =
+        Point{global.x - receiver->inner_x(), global.y - receiver->inner_y()};
+    const auto data = Mouse_data{input.button, global, local, 0};
+    if (input.kind == Decoded_input::Kind::Mouse_press) {
+        return std::make_unique<Mouse_press_event>(*receiver, data);
+    }
+    return std::make_unique<Mouse_release_event>(*receiver, data);
+}
+
+std::unique_ptr<Event> make_event(const Decoded_input& input) {
+    if (input.kind == Decoded_input::Kind::Key) {
+        return make_keyboard_event(input.key);
+    }
+    return make_mouse_event(input);
+}
+
+/// Appends the Events that resize the terminal, then the head Widget.
+void append_resize_events(std::vector<std::unique_ptr<Event>>& events) {
+    Widget* const receiver = System::head();
+    if (receiver == nullptr) {
+        return;
+    }
+    ::winsize size{};
+    ::ioctl(STDIN_FILENO, TIOCGWINSZ, &size);
+    events.push_back(std::make_unique<Terminal_resize_event>(*receiver));
+    events.push_back(std::make_unique<Resize_event>(
+        *receiver, Area{size.ws_col, size.ws_row}));
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+Input_reactor::Input_reactor() : epoll_fd_{::epoll_create1(EPOLL_CLOEXEC)} {
+    if (epoll_fd_ == -1) {
+        throw std::runtime_error{"Input_reactor::Input_reactor."};
+    }
+    ::sigset_t resize_signal;
+    ::sigemptyset(&resize_signal);
+    ::sigaddset(&resize_signal, SIGWINCH);
+    ::pthread_sigmask(SIG_BLOCK, &resize_signal, nullptr);
+    signal_fd_ = ::signalfd(-1, &resize_signal, SFD_NONBLOCK | SFD_CLOEXEC);
+    wake_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    // A descriptor that can't be added is never reported, not an error.
+    for (int fd : {STDIN_FILENO, signal_fd_, wake_fd_}) {
+        if (fd != -1) {
+            ::epoll_event interest{};
+            interest.events = EPOLLIN;
+            interest.data.fd = fd;
+            ::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &interest);
+        }
+    }
+}
+
+Input_reactor::~Input_reactor() {
+    for (int fd : {epoll_fd_, signal_fd_, wake_fd_}) {
+        if (fd != -1) {
+            ::close(fd);
+        }
+    }
+}
+
+std::vector<std::unique_ptr<Event>> Input_reactor::wait(
+    std::chrono::milliseconds timeout) {
+    using std::chrono::milliseconds;
+    if (decoder_.pending()) {
+        // Only wait as long as the rest of an escape sequence could take.
+        const auto waited = std::chrono::duration_cast<milliseconds>(
+            Clock_t::now() - last_read_);
+        const auto remaining = std::max(escape_delay - waited, milliseconds{0});
+        if (timeout < milliseconds{0} || remaining < timeout) {
+            timeout = remaining;
+        }
+    }
+    const auto max_ready = 3;
+    ::epoll_event ready[max_ready];
+    const auto count = ::epoll_wait(epoll_fd_, ready, max_ready,
+                                    static_cast<int>(timeout.count()));
+    auto resized = false;
+    for (auto i = 0; i < count; ++i) {
+        const auto fd = ready[i].data.fd;
+        if (fd == STDIN_FILENO) {
+            this->read_input();
+        } else if (fd == signal_fd_) {
+            drain(signal_fd_, sizeof(::signalfd_siginfo));
+            resized = true;
+        } else if (fd == wake_fd_) {
+            drain(wake_fd_, sizeof(std::uint64_t));
+        }
+    }
+    if (decoder_.pending() && Clock_t::now() - last_read_ >= escape_delay) {
+        decoder_.flush();
+    }
+    auto events = std::vector<std::unique_ptr<Event>>{};
+    auto input = Decoded_input{};
+    while (decoder_.next(input)) {
+        auto event = make_event(input);
+        if (event != nullptr) {
+            events.push_back(std::move(event));
+        }
+    }
+    if (resized) {
+        append_resize_events(events);
+    }
+    return events;
+}
+
+void Input_reactor::wake_up() {
+    if (wake_fd_ != -1) {
+        const auto one = std::uint64_t{1};
+        // A saturated counter is already set to wake the reactor.
+        const auto result = ::write(wake_fd_, &one, sizeof(one));
+        static_cast<void>(result);
+    }
+}
+
+void Input_reactor::read_input() {
+    char buffer[256];
+    const auto count = ::read(STDIN_FILENO, buffer, sizeof(buffer));
+    if (count > 0) {
+        decoder_.feed(buffer, static_cast<std::size_t>(count));
+        last_read_ = Clock_t::now();
+    } else if (count == 0) {
+        // End of input, stop polling stdin so wait() does not spin.
+        ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, STDIN_FILENO, nullptr);
+    }
+}
+
+void Input_reactor::drain(int fd, std::size_t size) {
+    char buffer[sizeof(::signalfd_siginfo)];
+    while (::read(fd, buffer, size) > 0) {
+    }
+}
+
+}  // namespace detail
+}  // namespace cppurses
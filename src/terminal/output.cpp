@@ -7,7 +7,9 @@
 #include <thread>
 #endif
 
+#include <array>
 #include <cstddef>
+#include <vector>
 
 #include <ncurses.h>
 #include <optional/optional.hpp>
@@ -16,6 +18,10 @@
 #include <cppurses/painter/brush.hpp>
 #include <cppurses/painter/color.hpp>
 #include <cppurses/painter/glyph.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/terminal/detail/escape_output.hpp>
+#include <cppurses/terminal/output_backend.hpp>
+#include <cppurses/terminal/terminal.hpp>
 
 #ifndef add_wchstr
 #include <cppurses/painter/detail/extended_char.hpp>
@@ -24,6 +30,15 @@
 namespace {
 using namespace cppurses;
 
+detail::Escape_output& escape_output() {
+    static detail::Escape_output output;
+    return output;
+}
+
+bool uses_escape_sequences() {
+    return System::terminal.output_backend() == Output_backend::Escape_sequence;
+}
+
 attr_t color_attr_t(Color c) {
     return static_cast<attr_t>(c) - detail::first_color_value;
 }
@@ -33,18 +48,6 @@ short find_pair(Color foreground, Color background) {
     return color_attr_t(background) * color_count + color_attr_t(foreground);
 }
 
-short find_pair(const Brush& brush) {
-    auto background = Color::Black;
-    if (brush.background_color()) {
-        background = *(brush.background_color());
-    }
-    auto foreground = Color::Black;
-    if (brush.foreground_color()) {
-        foreground = *(brush.foreground_color());
-    }
-    return find_pair(foreground, background);
-}
-
 attr_t attribute_to_attr_t(Attribute attr) {
     auto result = A_NORMAL;
     switch (attr) {
@@ -78,14 +81,54 @@ attr_t attribute_to_attr_t(Attribute attr) {
     return result;
 }
 
-attr_t find_attr_t(const Brush& brush) {
-    auto result = A_NORMAL;
-    for (Attribute a : Attribute_list) {
-        if (brush.has_attribute(a)) {
-            result |= attribute_to_attr_t(a);
+/// Color pairs and attr_t values, indexed by the packed parts of a Brush.
+struct Brush_table {
+    std::array<attr_t, 256> attributes;
+    std::array<short, Brush::color_code_count * Brush::color_code_count> pairs;
+};
+
+/// Returns the Color for the color code of a Brush, no color is Black.
+Color code_to_color(std::size_t code) {
+    return code == 0 ? Color::Black
+                     : static_cast<Color>(static_cast<int>(code) - 1 +
+                                          detail::first_color_value);
+}
+
+Brush_table make_brush_table() {
+    auto table = Brush_table{};
+    for (auto mask = std::size_t{0}; mask < table.attributes.size(); ++mask) {
+        auto result = A_NORMAL;
+        for (Attribute a : Attribute_list) {
+            if ((mask & (std::size_t{1} << static_cast<int>(a))) != 0) {
+                result |= attribute_to_attr_t(a);
+            }
         }
+        table.attributes[mask] = result;
     }
-    return result;
+    const auto codes = Brush::color_code_count;
+    for (auto background = std::size_t{0}; background < codes; ++background) {
+        for (auto foreground = std::size_t{0}; foreground < codes;
+             ++foreground) {
+            table.pairs[background * codes + foreground] = find_pair(
+                code_to_color(foreground), code_to_color(background));
+        }
+    }
+    return table;
+}
+
+const Brush_table& brush_table() {
+    static const auto table = make_brush_table();
+    return table;
+}
+
+short find_pair(const Brush& brush) {
+    return brush_table().pairs[brush.background_code() *
+                                   Brush::color_code_count +
+                               brush.foreground_code()];
+}
+
+attr_t find_attr_t(const Brush& brush) {
+    return brush_table().attributes[brush.attribute_mask()];
 }
 
 #ifdef SLOW_PAINT
@@ -116,6 +159,20 @@ void put_as_wchar(const Glyph& glyph) {
     ::setcchar(&symbol_and_attributes, symbol, attributes, color_pair, nullptr);
     ::wadd_wchnstr(::stdscr, &symbol_and_attributes, 1);
 }
+
+/// Adds \p count Glyphs sharing one Brush to the screen at cursor position.
+/** The color pair and attributes are found once for the entire run. */
+void put_run_as_wchar(const Glyph* glyphs, std::size_t count) {
+    static std::vector<cchar_t> run;
+    run.resize(count);
+    const auto color_pair = find_pair(glyphs[0].brush);
+    const auto attributes = find_attr_t(glyphs[0].brush);
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        const wchar_t symbol[2] = {glyphs[i].symbol, L'\0'};
+        ::setcchar(&run[i], symbol, attributes, color_pair, nullptr);
+    }
+    ::wadd_wchnstr(::stdscr, run.data(), static_cast<int>(count));
+}
 #else
 
 /// Adds \p glyph's symbol, with attributes, to the screen at cursor position.
@@ -140,11 +197,35 @@ void move_cursor(std::size_t x, std::size_t y) {
     ::wmove(::stdscr, static_cast<int>(y), static_cast<int>(x));
 }
 
+void show_cursor_at(std::size_t x, std::size_t y) {
+    if (uses_escape_sequences()) {
+        escape_output().show_cursor_at(x, y);
+        return;
+    }
+    // wrefresh() leaves the terminal cursor where the stdscr cursor is.
+    move_cursor(x, y);
+}
+
 void refresh() {
+    if (uses_escape_sequences()) {
+        escape_output().flush();
+        return;
+    }
     ::wrefresh(::stdscr);
 }
 
+std::size_t bytes_written() {
+    return escape_output().bytes_written();
+}
+
 void put(const Glyph& g) {
+    if (uses_escape_sequences()) {
+        int y{0};
+        int x{0};
+        getyx(::stdscr, y, x);
+        escape_output().put(x, y, &g, 1);
+        return;
+    }
 #ifdef SLOW_PAINT
     paint_indicator('X');
 #endif
@@ -159,5 +240,41 @@ void put(const Glyph& g) {
 #endif
 }
 
+void put(std::size_t x,
+         std::size_t y,
+         const Glyph* glyphs,
+         std::size_t count) {
+    if (count == 0) {
+        return;
+    }
+    if (uses_escape_sequences()) {
+        escape_output().put(x, y, glyphs, count);
+        return;
+    }
+#if defined(add_wchstr) && !defined(SLOW_PAINT)
+    move_cursor(x, y);
+    put_run_as_wchar(glyphs, count);
+#else  // Run is put one Glyph at a time.
+    for (auto i = std::size_t{0}; i < count; ++i) {
+        put(x + i, y, glyphs[i]);
+    }
+#endif
+}
+
+void scroll_rows(std::size_t top, std::size_t bottom, std::ptrdiff_t lines) {
+    if (top >= bottom || lines == 0) {
+        return;
+    }
+    if (uses_escape_sequences()) {
+        escape_output().scroll_rows(top, bottom, lines);
+        return;
+    }
+    ::wsetscrreg(::stdscr, static_cast<int>(top), static_cast<int>(bottom - 1));
+    ::scrollok(::stdscr, TRUE);
+    ::wscrl(::stdscr, static_cast<int>(lines));
+    ::scrollok(::stdscr, FALSE);
+    ::wsetscrreg(::stdscr, 0, getmaxy(::stdscr) - 1);
+}
+
 }  // namespace output
 }  // namespace cppurses
@@ -2,16 +2,25 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 #include <ncurses.h>
-#include <signal.h>
-#include <string.h>
+#include <unistd.h>
 
 #include <cppurses/painter/color_definition.hpp>
 #include <cppurses/painter/palette.hpp>
-#include <cppurses/terminal/input.hpp>
+#include <cppurses/terminal/output_backend.hpp>
 
 namespace {
+/// Mouse button reporting, in SGR (1006) format when the terminal has it.
+const char* const enable_mouse{"\033[?1000h\033[?1006h"};
+const char* const disable_mouse{"\033[?1006l\033[?1000l"};
+
+void write_sequence(const char* sequence) {
+    const auto result = ::write(STDOUT_FILENO, sequence, std::strlen(sequence));
+    static_cast<void>(result);
+}
+
 std::int16_t scale(std::int16_t value) {
     const auto value_max = 255;
     const auto ncurses_max = 999;
@@ -43,15 +52,13 @@ void Terminal::initialize() {
     }
     setenv("TERM", "xterm-256color", 1);
     std::setlocale(LC_ALL, "en_US.UTF-8");
-    this->setup_resize_signal_handler();
 
     ::initscr();
     is_initialized_ = true;
     ::noecho();
-    ::keypad(::stdscr, true);
-    ::ESCDELAY = 1;
-    ::mousemask(ALL_MOUSE_EVENTS, nullptr);
-    ::mouseinterval(0);
+    ::idlok(::stdscr, true);
+    // Input is read and decoded by detail::Input_reactor, not ncurses.
+    write_sequence(enable_mouse);
     if (this->has_color()) {
         ::start_color();
         using detail::first_color_value;
@@ -61,6 +68,10 @@ void Terminal::initialize() {
     this->ncurses_set_palette();
     this->ncurses_set_raw_mode();
     this->ncurses_set_cursor();
+    if (output_backend_ == Output_backend::Escape_sequence) {
+        // Let ncurses clear the screen now, not over the first frame.
+        ::wrefresh(::stdscr);
+    }
 }
 
 void Terminal::uninitialize() {
@@ -68,6 +79,7 @@ void Terminal::uninitialize() {
         return;
     }
     is_initialized_ = false;
+    write_sequence(disable_mouse);
     ::endwin();
 }
 
@@ -93,6 +105,20 @@ std::size_t Terminal::height() const {
 void Terminal::resize(std::size_t width, std::size_t height) {
     if (is_initialized_) {
         ::resizeterm(height, width);  // glitch here w/multi-thread?
+        if (output_backend_ == Output_backend::Escape_sequence) {
+            // ncurses repaints everything after a resize, do it before the
+            // next frame is written, Screen repaints all cells after a resize.
+            // Clearing first homes the cursor, frames may have left it where
+            // ncurses does not know.
+            ::clearok(::curscr, TRUE);
+            ::wrefresh(::stdscr);
+        }
+    }
+}
+
+void Terminal::set_output_backend(Output_backend backend) {
+    if (!is_initialized_) {
+        output_backend_ = backend;
     }
 }
 
@@ -138,13 +164,6 @@ bool Terminal::can_change_colors() const {
     return false;
 }
 
-void Terminal::setup_resize_signal_handler() const {
-    struct sigaction sa;
-    memset(&sa, 0, sizeof(struct sigaction));
-    sa.sa_handler = input::indicate_resize;
-    sigaction(SIGWINCH, &sa, NULL);
-}
-
 void Terminal::ncurses_set_palette() const {
     if (!this->can_change_colors()) {
         return;
@@ -8,6 +8,7 @@
 
 #include <cppurses/system/events/child_event.hpp>
 #include <cppurses/system/events/disable_event.hpp>
+#include <cppurses/system/focus.hpp>
 #include <cppurses/system/system.hpp>
 #include <cppurses/widget/widget.hpp>
 
@@ -21,6 +22,7 @@ void Children_data::add(std::unique_ptr<Widget> child) {
     children_.emplace_back(std::move(child));
     if (parent_ != nullptr) {
         children_.back()->enable(parent_->enabled());
+        Focus::update_chain_tree(*children_.back());
         System::post_event<Child_added_event>(*parent_,
                                               *children_.back().get());
     }
@@ -33,6 +35,7 @@ void Children_data::insert(std::unique_ptr<Widget> child, std::size_t index) {
             children_.insert(std::begin(children_) + index, std::move(child));
         if (parent_ != nullptr) {
             (*new_iter)->enable(parent_->enabled());
+            Focus::update_chain_tree(**new_iter);
             System::post_event<Child_added_event>(*parent_, *new_iter->get());
         }
     }
@@ -57,8 +60,11 @@ bool Children_data::has(const std::string& name) const {
 }
 
 bool Children_data::has_descendant(Widget* descendant) const {
-    for (const std::unique_ptr<Widget>& widg : children_) {
-        if (widg.get() == descendant || widg->children.has(descendant)) {
+    if (descendant == nullptr) {
+        return false;
+    }
+    for (Widget* w = descendant->parent(); w != nullptr; w = w->parent()) {
+        if (w == parent_) {
             return true;
         }
     }
@@ -67,7 +73,7 @@ bool Children_data::has_descendant(Widget* descendant) const {
 
 bool Children_data::has_descendant(const std::string& name) const {
     for (const std::unique_ptr<Widget>& widg : children_) {
-        if (widg->name() == name || widg->children.has(name)) {
+        if (widg->name() == name || widg->children.has_descendant(name)) {
             return true;
         }
     }
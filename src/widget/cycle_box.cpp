@@ -14,6 +14,7 @@ namespace cppurses {
 Cycle_box::Cycle_box() {
     this->set_alignment(Alignment::Center);  // might be default
     this->disable_word_wrap();
+    this->enable_paint_cache();
 }
 
 sig::Signal<void()>& Cycle_box::add_option(Glyph_string option) {
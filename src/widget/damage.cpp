@@ -0,0 +1,90 @@
+#include <cppurses/widget/detail/damage.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/rect.hpp>
+
+namespace {
+using namespace cppurses;
+
+std::size_t x_end(const Rect& r) {
+    return r.top_left.x + r.area.width;
+}
+
+std::size_t y_end(const Rect& r) {
+    return r.top_left.y + r.area.height;
+}
+
+std::size_t area_of(const Rect& r) {
+    return r.area.width * r.area.height;
+}
+
+/// Returns true if \p a and \p b overlap or share an edge.
+bool touches(const Rect& a, const Rect& b) {
+    return a.top_left.x <= x_end(b) && b.top_left.x <= x_end(a) &&
+           a.top_left.y <= y_end(b) && b.top_left.y <= y_end(a);
+}
+
+/// Returns the smallest Rect containing both \p a and \p b.
+Rect bounding(const Rect& a, const Rect& b) {
+    const auto x = std::min(a.top_left.x, b.top_left.x);
+    const auto y = std::min(a.top_left.y, b.top_left.y);
+    const auto width = std::max(x_end(a), x_end(b)) - x;
+    const auto height = std::max(y_end(a), y_end(b)) - y;
+    return Rect{Point{x, y}, Area{width, height}};
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+void Damage::add(const Rect& region) {
+    if (all_ || region.area.width == 0 || region.area.height == 0) {
+        return;
+    }
+    // Absorb every touching rectangle, the bounding box might touch others.
+    auto merged = region;
+    auto iter = std::begin(rects_);
+    while (iter != std::end(rects_)) {
+        if (touches(*iter, merged)) {
+            merged = bounding(*iter, merged);
+            rects_.erase(iter);
+            iter = std::begin(rects_);
+        } else {
+            ++iter;
+        }
+    }
+    if (rects_.size() < max_rects) {
+        rects_.push_back(merged);
+        return;
+    }
+    auto growth = [&merged](const Rect& r) {
+        return area_of(bounding(r, merged)) - area_of(r);
+    };
+    auto least = std::min_element(std::begin(rects_), std::end(rects_),
+                                  [&growth](const Rect& a, const Rect& b) {
+                                      return growth(a) < growth(b);
+                                  });
+    const auto combined = bounding(*least, merged);
+    rects_.erase(least);
+    this->add(combined);
+}
+
+bool Damage::contains(const Point& p) const {
+    if (this->is_all()) {
+        return true;
+    }
+    return std::any_of(std::begin(rects_), std::end(rects_),
+                       [&p](const Rect& r) {
+                           return p.x >= r.top_left.x && p.x < x_end(r) &&
+                                  p.y >= r.top_left.y && p.y < y_end(r);
+                       });
+}
+
+}  // namespace detail
+}  // namespace cppurses
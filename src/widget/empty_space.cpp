@@ -0,0 +1,139 @@
+#include <cppurses/widget/detail/empty_space.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/children_data.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/rect.hpp>
+#include <cppurses/widget/widget.hpp>
+
+namespace {
+using namespace cppurses;
+
+bool same_rect(const Rect& a, const Rect& b) {
+    return a.top_left == b.top_left && a.area.width == b.area.width &&
+           a.area.height == b.area.height;
+}
+
+Rect inner_rect(const Widget& w) {
+    return Rect{Point{w.inner_x(), w.inner_y()}, Area{w.width(), w.height()}};
+}
+
+/// Returns the outer area of \p child clipped to \p inner, might be empty.
+Rect clipped_outer_rect(const Widget& child, const Rect& inner) {
+    const auto left = std::max(child.x(), inner.top_left.x);
+    const auto top = std::max(child.y(), inner.top_left.y);
+    const auto right = std::min(child.x() + child.outer_width(),
+                                inner.top_left.x + inner.area.width);
+    const auto bottom = std::min(child.y() + child.outer_height(),
+                                 inner.top_left.y + inner.area.height);
+    if (left >= right || top >= bottom) {
+        return Rect{Point{left, top}, Area{0, 0}};
+    }
+    return Rect{Point{left, top}, Area{right - left, bottom - top}};
+}
+
+/// Calls \p f with the clipped outer area of each enabled child of \p w that
+/// overlaps \p inner, in order. Stops early if \p f returns false.
+template <typename Function>
+bool for_each_child_rect(const Widget& w, const Rect& inner, Function&& f) {
+    for (const std::unique_ptr<Widget>& child : w.children.get()) {
+        if (!child->enabled()) {
+            continue;
+        }
+        const auto r = clipped_outer_rect(*child, inner);
+        if (r.area.width != 0 && !f(r)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+namespace cppurses {
+namespace detail {
+
+void Empty_space::update(const Widget& w) {
+    const auto inner = inner_rect(w);
+    if (this->is_current(w, inner)) {
+        return;
+    }
+    inner_ = inner;
+    children_.clear();
+    for_each_child_rect(w, inner, [this](const Rect& r) {
+        children_.push_back(r);
+        return true;
+    });
+    this->sweep();
+    valid_ = true;
+}
+
+bool Empty_space::is_current(const Widget& w, const Rect& inner) const {
+    if (!valid_ || !same_rect(inner, inner_)) {
+        return false;
+    }
+    auto next = std::begin(children_);
+    const auto matched = for_each_child_rect(w, inner, [&](const Rect& r) {
+        return next != std::end(children_) && same_rect(*next++, r);
+    });
+    return matched && next == std::end(children_);
+}
+
+void Empty_space::sweep() {
+    gaps_.clear();
+    row_starts_.assign(1, 0);
+    // Children ordered by top edge, those overlapping the current row are kept
+    // ordered by left edge.
+    std::vector<const Rect*> by_top;
+    by_top.reserve(children_.size());
+    for (const Rect& r : children_) {
+        by_top.push_back(&r);
+    }
+    std::sort(std::begin(by_top), std::end(by_top),
+              [](const Rect* a, const Rect* b) {
+                  return a->top_left.y < b->top_left.y;
+              });
+    std::vector<const Rect*> active;
+    const auto by_left = [](const Rect* a, const Rect* b) {
+        return a->top_left.x < b->top_left.x;
+    };
+    const auto has_ended = [](const Rect* r, std::size_t y) {
+        return r->top_left.y + r->area.height <= y;
+    };
+    auto next = std::begin(by_top);
+    const auto left = inner_.top_left.x;
+    const auto right = left + inner_.area.width;
+    const auto bottom = inner_.top_left.y + inner_.area.height;
+    for (auto y = inner_.top_left.y; y < bottom; ++y) {
+        active.erase(std::remove_if(std::begin(active), std::end(active),
+                                    [&](const Rect* r) {
+                                        return has_ended(r, y);
+                                    }),
+                     std::end(active));
+        for (; next != std::end(by_top) && (*next)->top_left.y == y; ++next) {
+            active.insert(std::upper_bound(std::begin(active),
+                                           std::end(active), *next, by_left),
+                          *next);
+        }
+        auto x = left;
+        for (const Rect* r : active) {
+            if (r->top_left.x > x) {
+                gaps_.push_back(Gap{x, r->top_left.x});
+            }
+            x = std::max(x, r->top_left.x + r->area.width);
+        }
+        if (x < right) {
+            gaps_.push_back(Gap{x, right});
+        }
+        row_starts_.push_back(gaps_.size());
+    }
+}
+
+}  // namespace detail
+}  // namespace cppurses
@@ -0,0 +1,16 @@
+#include <cppurses/widget/focus_policy.hpp>
+
+#include <cppurses/system/focus.hpp>
+#include <cppurses/widget/widget.hpp>
+
+namespace cppurses {
+
+Focus_policy_data& Focus_policy_data::operator=(Focus_policy policy) {
+    if (policy_ != policy) {
+        policy_ = policy;
+        Focus::update_chain(*owner_);
+    }
+    return *this;
+}
+
+}  // namespace cppurses
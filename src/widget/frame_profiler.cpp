@@ -0,0 +1,188 @@
+#include <cppurses/widget/widgets/frame_profiler.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <signals/slot.hpp>
+
+#include <cppurses/painter/glyph_string.hpp>
+#include <cppurses/system/detail/render_scheduler.hpp>
+#include <cppurses/system/event_loop.hpp>
+#include <cppurses/system/key.hpp>
+#include <cppurses/system/shortcuts.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/system/tracer.hpp>
+#include <cppurses/widget/size_policy.hpp>
+
+namespace {
+
+/// Formats \p us microseconds as milliseconds with one decimal.
+std::string as_ms(double us) {
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(1) << us / 1000.0 << "ms";
+    return ss.str();
+}
+
+/// Formats a per second rate of \p count over \p seconds.
+std::string per_second(std::size_t count, double seconds) {
+    const auto rate = seconds > 0.0 ? count / seconds : 0.0;
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(0) << rate << "/s";
+    return ss.str();
+}
+
+}  // namespace
+
+namespace cppurses {
+
+constexpr std::size_t Frame_profiler::refresh_rate;
+constexpr std::size_t Frame_profiler::top_count;
+
+Frame_profiler::Frame_profiler(Key toggle_key) {
+    this->height_policy.type(Size_policy::Fixed);
+    this->height_policy.hint(2 + top_count);
+    sig::Slot<void()> toggle_slot{[this] { this->toggle(); }};
+    toggle_slot.track(this->destroyed);
+    Shortcuts::add_shortcut(toggle_key).connect(toggle_slot);
+    this->disable();
+}
+
+void Frame_profiler::toggle() {
+    if (shown_) {
+        this->hide();
+    } else {
+        this->show();
+    }
+}
+
+void Frame_profiler::enable(bool enable, bool post_child_polished_event) {
+    Text_display::enable(enable && shown_, post_child_polished_event);
+}
+
+bool Frame_profiler::timer_event() {
+    this->sample();
+    this->update_text();
+    return Text_display::timer_event();
+}
+
+void Frame_profiler::show() {
+    shown_ = true;
+    tracer_was_enabled_ = Tracer::enabled();
+    Tracer::enable();
+    samples_.fill(Counter_sample{});
+    next_sample_ = 0;
+    // Only Widget time from now on is ranked.
+    previous_costs_.clear();
+    for (const auto& cost : Tracer::widget_costs()) {
+        previous_costs_.emplace(cost.widget, cost);
+    }
+    top_widgets_.clear();
+    refreshes_ = 0;
+    this->sample();
+    this->update_text();
+    this->enable();
+    this->enable_animation(std::chrono::milliseconds{1000 / refresh_rate});
+}
+
+void Frame_profiler::hide() {
+    shown_ = false;
+    this->disable_animation();
+    this->disable();
+    Tracer::enable(tracer_was_enabled_);
+}
+
+void Frame_profiler::sample() {
+    const auto stats = System::main_event_loop().render_stats();
+    samples_[next_sample_] = Counter_sample{
+        Clock_t::now(), stats.events_dispatched, stats.coalesced_paints};
+    next_sample_ = (next_sample_ + 1) % samples_.size();
+    if (++refreshes_ % refresh_rate != 0) {
+        return;
+    }
+    // Once a second, rank Widgets by their paint time since the last time.
+    auto costs = Tracer::widget_costs();
+    auto totals = std::unordered_map<const Widget*, Tracer::Widget_cost>{};
+    for (auto& cost : costs) {
+        totals.emplace(cost.widget, cost);
+        const auto previous = previous_costs_.find(cost.widget);
+        if (previous != std::end(previous_costs_) &&
+            previous->second.handler_us <= cost.handler_us &&
+            previous->second.paint_us <= cost.paint_us) {
+            cost.handler_us -= previous->second.handler_us;
+            cost.paint_us -= previous->second.paint_us;
+        }
+    }
+    // Destroyed Widgets are no longer listed by the Tracer, dropped here too.
+    previous_costs_ = std::move(totals);
+    const auto middle =
+        std::begin(costs) + std::min(top_count, costs.size());
+    std::partial_sort(std::begin(costs), middle, std::end(costs),
+                      [](const Tracer::Widget_cost& a,
+                         const Tracer::Widget_cost& b) {
+                          return a.paint_us > b.paint_us;
+                      });
+    costs.erase(middle, std::end(costs));
+    top_widgets_ = std::move(costs);
+}
+
+void Frame_profiler::update_text() {
+    // Frames flushed in the last second.
+    const auto now = Clock_t::now();
+    const auto second_ago = now - std::chrono::seconds{1};
+    auto frames = std::size_t{0};
+    auto total_us = std::uint64_t{0};
+    auto max_us = std::uint64_t{0};
+    auto cells = std::size_t{0};
+    auto bytes = std::size_t{0};
+    for (const auto& frame : System::main_event_loop().recent_frames()) {
+        if (frame.end < second_ago) {
+            continue;
+        }
+        const auto us = static_cast<std::uint64_t>(frame.duration.count());
+        ++frames;
+        total_us += us;
+        max_us = std::max(max_us, us);
+        cells += frame.cells;
+        bytes += frame.bytes;
+    }
+    const auto mean_us =
+        frames == 0 ? 0.0 : static_cast<double>(total_us) / frames;
+
+    // Counter deltas between the newest and the oldest sample.
+    const auto& newest =
+        samples_[(next_sample_ + samples_.size() - 1) % samples_.size()];
+    const auto& oldest = samples_[next_sample_];
+    const auto has_oldest = oldest.when != Clock_t::time_point{};
+    const auto& first = has_oldest ? oldest : samples_[0];
+    const auto seconds =
+        std::chrono::duration<double>(newest.when - first.when).count();
+
+    std::ostringstream text;
+    text << "frame " << as_ms(mean_us) << " avg " << as_ms(max_us) << " max "
+         << frames << " fps  cells " << cells << "/s  bytes " << bytes
+         << "/s\n";
+    text << "events "
+         << per_second(newest.events_dispatched - first.events_dispatched,
+                       seconds)
+         << "  coalesced paints "
+         << per_second(newest.coalesced_paints - first.coalesced_paints,
+                       seconds);
+    for (const auto& cost : top_widgets_) {
+        text << "\n  " << as_ms(static_cast<double>(cost.paint_us))
+             << " paint  " << as_ms(static_cast<double>(cost.handler_us))
+             << " all events  "
+             << (cost.name.empty() ? std::string{"(unnamed)"} : cost.name);
+    }
+    this->set_text(text.str());
+}
+
+}  // namespace cppurses
@@ -19,6 +19,7 @@ Labeled_cycle_box::Labeled_cycle_box(Glyph_string title) {
     label.border.east_enabled = true;
     label.border.east = L'├';
     enable_border(label);
+    label.enable_paint_cache();
 }
 
 void Labeled_cycle_box::set_title(Glyph_string title) {
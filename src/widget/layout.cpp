@@ -1,15 +1,118 @@
 #include <cppurses/widget/layout.hpp>
 
+#include <iterator>
 #include <memory>
 #include <vector>
 
 #include <cppurses/painter/color.hpp>
+#include <cppurses/system/events/move_event.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/area.hpp>
 #include <cppurses/widget/children_data.hpp>
+#include <cppurses/widget/point.hpp>
 #include <cppurses/widget/widget.hpp>
 #include <cppurses/widget/widget_free_functions.hpp>
 
 namespace cppurses {
 
+void Layout::enable(bool enable, bool post_child_polished_event) {
+    if (enable && !this->enabled()) {
+        // Children were disabled along with this Layout, and might not fit.
+        this->invalidate_geometry();
+        placed_.clear();
+    }
+    Widget::enable(enable, post_child_polished_event);
+}
+
+bool Layout::move_event(Point new_position, Point old_position) {
+    if (geometry_dirty_) {
+        this->refresh_geometry();
+    } else {
+        // Sizes are unchanged, shift each placed child by the same distance.
+        for (const std::unique_ptr<Widget>& c : this->children.get()) {
+            const auto placed = placed_.find(c.get());
+            if (placed == std::end(placed_)) {
+                continue;
+            }
+            const Point& p{placed->second.position};
+            this->place_child(
+                *c,
+                Point{p.x - old_position.x + new_position.x,
+                      p.y - old_position.y + new_position.y},
+                placed->second.size);
+        }
+    }
+    return Widget::move_event(new_position, old_position);
+}
+
+bool Layout::resize_event(Area new_size, Area old_size) {
+    if (new_size.width != old_size.width ||
+        new_size.height != old_size.height) {
+        this->invalidate_geometry();
+    }
+    this->refresh_geometry();
+    return Widget::resize_event(new_size, old_size);
+}
+
+bool Layout::child_added_event(Widget& child) {
+    this->invalidate_geometry();
+    this->refresh_geometry();
+    return Widget::child_added_event(child);
+}
+
+bool Layout::child_removed_event(Widget& child) {
+    placed_.erase(&child);
+    this->invalidate_geometry();
+    this->refresh_geometry();
+    return Widget::child_removed_event(child);
+}
+
+bool Layout::child_polished_event(Widget& child) {
+    this->invalidate_geometry();
+    this->refresh_geometry();
+    return Widget::child_polished_event(child);
+}
+
+void Layout::enable_children() {
+    if (!this->enabled()) {
+        this->enable(true, false);
+        return;
+    }
+    for (const std::unique_ptr<Widget>& c : this->children.get()) {
+        if (!c->enabled()) {
+            placed_.erase(c.get());
+            c->enable(true, false);
+        }
+    }
+}
+
+void Layout::place_child(Widget& child, Point position, Area size) {
+    const auto placed = placed_.find(&child);
+    const bool is_new{placed == std::end(placed_)};
+    if (is_new || placed->second.position != position) {
+        System::post_event<Move_event>(child, position);
+    }
+    if (is_new || placed->second.size.width != size.width ||
+        placed->second.size.height != size.height) {
+        System::post_event<Resize_event>(child, size);
+    }
+    placed_[&child] = Child_geometry{position, size};
+}
+
+void Layout::disable_child(Widget& child) {
+    placed_.erase(&child);
+    child.disable(true, false);  // don't send child_polished_events
+}
+
+void Layout::refresh_geometry() {
+    if (!geometry_dirty_) {
+        return;
+    }
+    this->update_geometry();
+    geometry_dirty_ = false;
+}
+
 // Free Functions
 void set_background(Layout& l, Color c) {
     for (const std::unique_ptr<Widget>& w : l.children.get()) {
@@ -1,8 +1,10 @@
 #include <cppurses/widget/widgets/matrix_display.hpp>
 
+#include <algorithm>
 #include <cstddef>
 
 #include <cppurses/painter/painter.hpp>
+#include <cppurses/widget/rect.hpp>
 
 namespace cppurses {
 
@@ -22,9 +24,22 @@ bool Matrix_display::paint_event() {
     std::size_t h{matrix.height() > this->height() ? this->height()
                                                    : matrix.height()};
     Painter p{*this};
-    for (std::size_t y{0}; y < h; ++y) {
-        for (std::size_t x{0}; x < w; ++x) {
-            p.put(matrix(x, y), x, y);
+    auto paint = [this, &p](std::size_t x_begin, std::size_t y_begin,
+                            std::size_t x_end, std::size_t y_end) {
+        for (std::size_t y{y_begin}; y < y_end; ++y) {
+            for (std::size_t x{x_begin}; x < x_end; ++x) {
+                p.put(matrix(x, y), x, y);
+            }
+        }
+    };
+    if (this->damage().is_all()) {
+        paint(0, 0, w, h);
+    } else {
+        for (const Rect& region : this->damage().rects()) {
+            const auto x_end = region.top_left.x + region.area.width;
+            const auto y_end = region.top_left.y + region.area.height;
+            paint(region.top_left.x, region.top_left.y, std::min(x_end, w),
+                  std::min(y_end, h));
         }
     }
     return Widget::paint_event();
@@ -28,6 +28,7 @@ Menu::Menu(Glyph_string title)
     this->focus_policy = Focus_policy::Strong;
     title_.set_alignment(Alignment::Center);
     title_.brush.add_attributes(Attribute::Bold);
+    title_.enable_paint_cache();
     space1.wallpaper = L'─';
 }
 
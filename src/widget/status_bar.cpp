@@ -9,7 +9,9 @@
 namespace cppurses {
 
 Status_bar::Status_bar(Glyph_string initial_message)
-    : Label{std::move(initial_message)} {}
+    : Label{std::move(initial_message)} {
+    this->enable_paint_cache();
+}
 
 void Status_bar::update_status(Glyph_string message) {
     this->set_text(std::move(message));
@@ -11,7 +11,9 @@
 #include <cppurses/painter/attribute.hpp>
 #include <cppurses/painter/glyph_string.hpp>
 #include <cppurses/painter/painter.hpp>
+#include <cppurses/widget/area.hpp>
 #include <cppurses/widget/point.hpp>
+#include <cppurses/widget/rect.hpp>
 
 namespace cppurses {
 
@@ -24,6 +26,7 @@ void Text_display::update() {
 
 void Text_display::set_text(Glyph_string text) {
     contents_ = std::move(text);
+    this->content_changed();
     this->update();
     top_line_ = 0;
     this->cursor.set_position({0, 0});
@@ -44,6 +47,7 @@ void Text_display::insert(Glyph_string text, std::size_t index) {
     }
     contents_.insert(std::begin(contents_) + index, std::begin(text),
                      std::end(text));
+    this->content_changed();
     this->update();
     text_changed(contents_);
 }
@@ -56,8 +60,18 @@ void Text_display::append(Glyph_string text) {
             }
         }
     }
+    // Only lines from the one holding the current end can change.
+    const auto first_changed = this->line_at(contents_.size());
     contents_.append(text);
-    this->update();
+    this->content_changed();
+    this->update_display();
+    if (first_changed < this->top_line()) {
+        Widget::update();
+    } else if (first_changed - this->top_line() < this->height()) {
+        const auto y = first_changed - this->top_line();
+        const auto area = Area{this->width(), this->height() - y};
+        Widget::update(Rect{Point{0, y}, area});
+    }
     text_changed(contents_);
 }
 
@@ -70,6 +84,7 @@ void Text_display::erase(std::size_t index, std::size_t length) {
         end = std::end(contents_);
     }
     contents_.erase(std::begin(contents_) + index, end);
+    this->content_changed();
     this->update();
     text_changed(contents_);
 }
@@ -79,6 +94,7 @@ void Text_display::pop_back() {
         return;
     }
     contents_.pop_back();
+    this->content_changed();
     this->update();
     text_changed(contents_);
 }
@@ -87,27 +103,36 @@ void Text_display::clear() {
     contents_.clear();
     this->cursor.set_x(0);
     this->cursor.set_y(0);
+    this->content_changed();
     this->update();
     text_changed(contents_);
 }
 
 void Text_display::scroll_up(std::size_t n) {
+    const auto old_top = top_line_;
     if (n > this->top_line()) {
         top_line_ = 0;
     } else {
         top_line_ -= n;
     }
+    this->hint_scroll(static_cast<std::ptrdiff_t>(top_line_) -
+                      static_cast<std::ptrdiff_t>(old_top));
+    this->content_changed();
     this->update();
     scrolled_up(n);
     scrolled();
 }
 
 void Text_display::scroll_down(std::size_t n) {
+    const auto old_top = top_line_;
     if (this->top_line() + n > this->last_line()) {
         top_line_ = this->last_line();
     } else {
         top_line_ += n;
     }
+    this->hint_scroll(static_cast<std::ptrdiff_t>(top_line_) -
+                      static_cast<std::ptrdiff_t>(old_top));
+    this->content_changed();
     this->update();
     scrolled_down(n);
     scrolled();
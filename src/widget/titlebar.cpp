@@ -28,6 +28,7 @@ Titlebar::Titlebar(const Glyph_string& title_)
     this->height_policy.type(Size_policy::Fixed);
     this->height_policy.hint(1);
     title.set_alignment(Alignment::Center);
+    title.enable_paint_cache();
 }
 void Titlebar::set_title(Glyph_string title_) {
     title.set_text(std::move(title_));
@@ -15,6 +15,7 @@
 #include <cppurses/painter/color.hpp>
 #include <cppurses/painter/glyph.hpp>
 #include <cppurses/system/animation_engine.hpp>
+#include <cppurses/system/detail/hit_map.hpp>
 #include <cppurses/system/events/child_event.hpp>
 #include <cppurses/system/events/delete_event.hpp>
 #include <cppurses/system/events/disable_event.hpp>
@@ -22,10 +23,12 @@
 #include <cppurses/system/events/paint_event.hpp>
 #include <cppurses/system/focus.hpp>
 #include <cppurses/system/system.hpp>
+#include <cppurses/system/tracer.hpp>
 #include <cppurses/terminal/terminal.hpp>
 #include <cppurses/widget/border.hpp>
 #include <cppurses/widget/children_data.hpp>
 #include <cppurses/widget/cursor_data.hpp>
+#include <cppurses/widget/rect.hpp>
 
 namespace {
 std::uint16_t get_unique_id() {
@@ -37,10 +40,6 @@ std::uint16_t get_unique_id() {
 }  // namespace
 
 namespace cppurses {
-namespace detail {
-class Screen_state;
-}  // namespace detail
-
 Widget::Widget(std::string name)
     : name_{std::move(name)}, unique_id_{get_unique_id()} {}
 
@@ -49,6 +48,10 @@ Widget::~Widget() {
         Focus::clear_focus();
     }
     destroyed(*this);
+    detail::Hit_map::forget(*this);
+    Tracer::forget(*this);
+    Focus::unlink(*this);
+    System::discard_events(*this);
 }
 
 void Widget::set_name(std::string name) {
@@ -84,6 +87,15 @@ Glyph Widget::generate_wallpaper() const {
 }
 
 void Widget::update() {
+    damage_.add_all();
+    System::post_event<Paint_event>(*this);
+}
+
+void Widget::update(const Rect& region) {
+    if (region.area.width == 0 || region.area.height == 0) {
+        return;
+    }
+    damage_.add(region);
     System::post_event<Paint_event>(*this);
 }
 
@@ -129,6 +141,8 @@ void Widget::enable_and_post_events(bool enable,
             System::post_event<Disable_event>(*this);
         }
         enabled_ = enable;
+        detail::Hit_map::invalidate(*this);
+        Focus::update_chain(*this);
         if (enable) {
             System::post_event<Enable_event>(*this);
         }
@@ -0,0 +1,102 @@
+// Posts 100k Move, Resize and Paint Events spread over 1k Widgets to an
+// Event_queue, then drains it with an Event_invoker. Reports the throughput of
+// both and how many Events were left to send after duplicates were removed.
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <cppurses/system/detail/event_invoker.hpp>
+#include <cppurses/system/detail/event_queue.hpp>
+#include <cppurses/system/event.hpp>
+#include <cppurses/system/events/move_event.hpp>
+#include <cppurses/system/events/paint_event.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/widget.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+using Clock_t = std::chrono::steady_clock;
+
+const auto widget_count = std::size_t{1000};
+const auto event_count = std::size_t{100000};
+
+/// Counts the Events sent to it, without doing any other work.
+class Receiver : public Widget {
+   public:
+    Receiver() { this->enable(); }
+
+    static std::size_t received;
+
+   protected:
+    bool move_event(Point, Point) override { return count(); }
+    bool resize_event(Area, Area) override { return count(); }
+    bool paint_event() override { return count(); }
+
+   private:
+    static bool count() {
+        ++received;
+        return true;
+    }
+};
+
+std::size_t Receiver::received{0};
+
+double seconds(Clock_t::duration d) {
+    return std::chrono::duration<double>(d).count();
+}
+
+}  // namespace
+
+int main() {
+    auto widgets = std::vector<std::unique_ptr<Receiver>>{};
+    for (auto i = std::size_t{0}; i < widget_count; ++i) {
+        widgets.push_back(std::make_unique<Receiver>());
+    }
+    // Created before timing, so only the Event_queue is measured.
+    auto events = std::vector<std::unique_ptr<Event>>{};
+    events.reserve(event_count);
+    for (auto i = std::size_t{0}; i < event_count; ++i) {
+        auto& w = *widgets[i % widget_count];
+        const auto n = i / widget_count;
+        switch (n % 3) {
+            case 0:
+                events.push_back(std::make_unique<Move_event>(w, Point{n, n}));
+                break;
+            case 1:
+                events.push_back(
+                    std::make_unique<Resize_event>(w, Area{n + 1, n + 1}));
+                break;
+            default:
+                events.push_back(std::make_unique<Paint_event>(w));
+        }
+    }
+
+    detail::Event_queue queue;
+    detail::Event_invoker invoker;
+    const auto append_start = Clock_t::now();
+    for (auto& event : events) {
+        queue.append(std::move(event));
+    }
+    const auto drain_start = Clock_t::now();
+    invoker.invoke(queue);
+    invoker.invoke(queue, Event::Paint);
+    const auto drain_end = Clock_t::now();
+
+    const auto append_time = seconds(drain_start - append_start);
+    const auto drain_time = seconds(drain_end - drain_start);
+    std::cout << std::fixed << std::setprecision(2) << event_count
+              << " Events posted to " << widget_count << " Widgets, "
+              << Receiver::received << " sent\n"
+              << "append " << std::setw(10) << append_time * 1e3 << " ms  "
+              << event_count / append_time / 1e6 << " million Events/s\n"
+              << "drain  " << std::setw(10) << drain_time * 1e3 << " ms  "
+              << Receiver::received / drain_time / 1e6
+              << " million Events/s sent\n";
+}
@@ -0,0 +1,215 @@
+// Input-to-screen latency with 10 concurrent animations. The application runs
+// in a child process on a pseudo terminal. Ten Widgets are animated, each with
+// its own period. The parent writes a key press to the terminal and waits for
+// the glyph the focused Widget paints in response to be written back.
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/painter/painter.hpp>
+#include <cppurses/system/focus.hpp>
+#include <cppurses/system/keyboard_data.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/widget/focus_policy.hpp>
+#include <cppurses/widget/layouts/vertical_layout.hpp>
+#include <cppurses/widget/size_policy.hpp>
+#include <cppurses/widget/widget.hpp>
+
+using namespace cppurses;
+using Clock_t = std::chrono::steady_clock;
+
+namespace {
+
+const auto animation_count = 10;
+const auto press_count = 300;
+const auto press_gap = std::chrono::milliseconds{25};
+const auto timeout = std::chrono::seconds{2};
+
+/// Glyphs the key press Widget cycles through, none is used by escape codes.
+const std::string markers{"!#$%&*+,-./:"};
+
+/// Fills itself with the next letter every period.
+class Animated : public Widget {
+   public:
+    explicit Animated(std::chrono::milliseconds period) {
+        this->enable_animation(period);
+    }
+
+   protected:
+    bool timer_event() override {
+        ++frame_;
+        this->update();
+        return Widget::timer_event();
+    }
+
+    bool paint_event() override {
+        Painter p{*this};
+        const auto letter = static_cast<wchar_t>(L'a' + frame_ % 26);
+        for (auto y = std::size_t{0}; y < this->height(); ++y) {
+            for (auto x = std::size_t{0}; x < this->width(); ++x) {
+                p.put(Glyph{letter}, x, y);
+            }
+        }
+        return Widget::paint_event();
+    }
+
+   private:
+    std::size_t frame_{0};
+};
+
+/// Shows the next marker Glyph on each key press.
+class Key_display : public Widget {
+   public:
+    Key_display() {
+        this->focus_policy = Focus_policy::Strong;
+        this->height_policy.type(Size_policy::Fixed);
+        this->height_policy.hint(1);
+    }
+
+   protected:
+    bool key_press_event(const Keyboard_data& keyboard) override {
+        ++presses_;
+        this->update();
+        return Widget::key_press_event(keyboard);
+    }
+
+    bool paint_event() override {
+        Painter p{*this};
+        const auto marker = markers[presses_ % markers.size()];
+        p.put(Glyph{static_cast<wchar_t>(marker)}, 0, 0);
+        return Widget::paint_event();
+    }
+
+   private:
+    std::size_t presses_{0};
+};
+
+int run_application() {
+    System sys;
+    Vertical_layout head;
+    auto& display = head.make_child<Key_display>();
+    for (auto i = 0; i < animation_count; ++i) {
+        head.make_child<Animated>(std::chrono::milliseconds{10 + i});
+    }
+    System::set_head(&head);
+    Focus::set_focus_to(&display);
+    return sys.run();
+}
+
+/// Reads from \p fd until \p marker is read, returns false on timeout.
+bool wait_for(int fd, char marker) {
+    const auto deadline = Clock_t::now() + timeout;
+    char buffer[4096];
+    while (Clock_t::now() < deadline) {
+        pollfd pfd{fd, POLLIN, 0};
+        if (::poll(&pfd, 1, 100) <= 0) {
+            continue;
+        }
+        const auto n = ::read(fd, buffer, sizeof(buffer));
+        if (n <= 0) {
+            return false;
+        }
+        if (std::find(buffer, buffer + n, marker) != buffer + n) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Reads and discards everything written to \p fd within \p duration.
+void drain(int fd, Clock_t::duration duration) {
+    const auto deadline = Clock_t::now() + duration;
+    char buffer[4096];
+    while (Clock_t::now() < deadline) {
+        pollfd pfd{fd, POLLIN, 0};
+        if (::poll(&pfd, 1, 5) > 0 && ::read(fd, buffer, sizeof(buffer)) <= 0) {
+            return;
+        }
+    }
+}
+
+double percentile(const std::vector<double>& sorted, double p) {
+    const auto index = static_cast<std::size_t>(p * (sorted.size() - 1));
+    return sorted[index];
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string{argv[1]} == "--application") {
+        return run_application();
+    }
+    const int master = ::posix_openpt(O_RDWR | O_NOCTTY);
+    if (master == -1 || ::grantpt(master) != 0 || ::unlockpt(master) != 0) {
+        std::cerr << "no pseudo terminal available\n";
+        return 1;
+    }
+    winsize size{};
+    size.ws_row = 24;
+    size.ws_col = 80;
+    ::ioctl(master, TIOCSWINSZ, &size);
+    const std::string slave_name{::ptsname(master)};
+
+    const pid_t child = ::fork();
+    if (child == 0) {
+        ::setsid();
+        const int slave = ::open(slave_name.c_str(), O_RDWR);
+        ::close(master);
+        ::dup2(slave, STDIN_FILENO);
+        ::dup2(slave, STDOUT_FILENO);
+        const int null = ::open("/dev/null", O_WRONLY);
+        ::dup2(null, STDERR_FILENO);
+        ::setenv("TERM", "xterm-256color", 0);
+        // Input is watched from static initialization, which must see the
+        // terminal as stdin.
+        ::execl("/proc/self/exe", argv[0], "--application", nullptr);
+        std::_Exit(1);
+    }
+
+    drain(master, std::chrono::seconds{1});
+    std::vector<double> latencies;
+    auto timeouts = 0;
+    for (auto i = 1; i <= press_count; ++i) {
+        const auto marker = markers[i % markers.size()];
+        const auto start = Clock_t::now();
+        if (::write(master, "x", 1) != 1) {
+            break;
+        }
+        if (wait_for(master, marker)) {
+            const auto elapsed = Clock_t::now() - start;
+            latencies.push_back(
+                std::chrono::duration<double, std::milli>(elapsed).count());
+        } else {
+            ++timeouts;
+        }
+        drain(master, press_gap);
+    }
+    ::kill(child, SIGKILL);
+    ::waitpid(child, nullptr, 0);
+
+    if (latencies.empty()) {
+        std::cerr << "no key press reached the screen\n";
+        return 1;
+    }
+    std::sort(std::begin(latencies), std::end(latencies));
+    std::cout << std::fixed << std::setprecision(2) << animation_count
+              << " animations, " << latencies.size() << " key presses, "
+              << timeouts << " timed out\nlatency ms  median "
+              << percentile(latencies, 0.5) << "  p90 "
+              << percentile(latencies, 0.9) << "  p99 "
+              << percentile(latencies, 0.99) << "  max " << latencies.back()
+              << '\n';
+}
@@ -0,0 +1,83 @@
+// Resizes a tree of 2,001 Widgets, a Vertical_layout of 40 Horizontal_layouts
+// each holding 49 Widgets, as a terminal resize would. Counts the Events
+// posted while the resize is processed, and the Move and Resize Events that
+// reach the leaf Widgets.
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+#include <cppurses/system/detail/event_pool.hpp>
+#include <cppurses/system/event_loop.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/layouts/horizontal_layout.hpp>
+#include <cppurses/widget/layouts/vertical_layout.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/widget.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+const auto rows = std::size_t{40};
+const auto columns = std::size_t{49};
+
+/// Processes the Events posted before run(), then exits.
+class Once_loop : public Event_loop {
+   protected:
+    void loop_function() override { this->exit(0); }
+};
+
+/// Counts the Move and Resize Events sent to it.
+class Leaf : public Widget {
+   public:
+    static std::size_t moves;
+    static std::size_t resizes;
+
+   protected:
+    bool move_event(Point new_position, Point old_position) override {
+        ++moves;
+        return Widget::move_event(new_position, old_position);
+    }
+
+    bool resize_event(Area new_size, Area old_size) override {
+        ++resizes;
+        return Widget::resize_event(new_size, old_size);
+    }
+};
+
+std::size_t Leaf::moves{0};
+std::size_t Leaf::resizes{0};
+
+/// Resizes \p head to \p size and prints the Events it took.
+void resize(const char* name, Widget& head, Area size) {
+    Leaf::moves = 0;
+    Leaf::resizes = 0;
+    const auto posted_before = detail::Event_pool::stats().allocations;
+    Once_loop loop;
+    loop.post_event(std::make_unique<Resize_event>(head, size));
+    loop.run();
+    const auto posted = detail::Event_pool::stats().allocations - posted_before;
+    std::cout << std::setw(24) << std::left << name << "posted "
+              << std::setw(8) << posted << "leaf moves " << std::setw(7)
+              << Leaf::moves << "leaf resizes " << Leaf::resizes << '\n';
+}
+
+}  // namespace
+
+int main() {
+    Vertical_layout head;
+    for (auto r = std::size_t{0}; r < rows; ++r) {
+        auto& row = head.make_child<Horizontal_layout>();
+        for (auto c = std::size_t{0}; c < columns; ++c) {
+            row.make_child<Leaf>();
+        }
+    }
+    head.enable();
+    std::cout << 1 + rows + rows * columns << " Widgets\n";
+    resize("first layout 200x100", head, Area{200, 100});
+    resize("width to 180", head, Area{180, 100});
+    resize("height to 90", head, Area{180, 90});
+    resize("same size", head, Area{180, 90});
+}
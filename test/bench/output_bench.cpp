@@ -0,0 +1,118 @@
+// Measures output::put() throughput for each Output_backend. Frames of 300x100
+// Glyphs with a mix of colors and attributes are put one Glyph at a time and
+// as runs of 10 Glyphs sharing a Brush. ncurses is started on /dev/null, the
+// escape backend writes its frames there as well.
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <fcntl.h>
+#include <ncurses.h>
+#include <unistd.h>
+
+#include <cppurses/painter/attribute.hpp>
+#include <cppurses/painter/brush.hpp>
+#include <cppurses/painter/color.hpp>
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/system/system.hpp>
+#include <cppurses/terminal/output.hpp>
+#include <cppurses/terminal/output_backend.hpp>
+#include <cppurses/terminal/terminal.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+using Clock_t = std::chrono::steady_clock;
+
+const auto width = std::size_t{300};
+const auto height = std::size_t{100};
+const auto run_length = std::size_t{10};
+const auto frames = 100;
+const auto repeats = 5;
+
+/// A frame of Glyphs, the Brush changes every run_length Glyphs.
+std::vector<Glyph> make_frame() {
+    auto frame = std::vector<Glyph>{};
+    frame.reserve(width * height);
+    for (auto i = std::size_t{0}; i < width * height; ++i) {
+        const auto n = i / run_length;
+        auto brush = Brush{};
+        brush.set_foreground(static_cast<Color>(
+            detail::first_color_value + static_cast<int>(n % 16)));
+        brush.set_background(static_cast<Color>(
+            detail::first_color_value + static_cast<int>((n / 16) % 16)));
+        for (auto a = std::size_t{0}; a < Attribute_list.size(); ++a) {
+            if (((n * 37) >> a) & 1) {
+                brush.add_attributes(Attribute_list[a]);
+            }
+        }
+        frame.push_back(Glyph{static_cast<wchar_t>(L'a' + i % 26), brush});
+    }
+    return frame;
+}
+
+/// Returns millions of Glyphs put per second, best of repeats.
+/** refresh() is called after each frame, it is not timed. */
+template <typename Put_frame>
+double throughput(Put_frame&& put_frame) {
+    auto best = 0.0;
+    for (auto repeat = 0; repeat < repeats; ++repeat) {
+        auto elapsed = Clock_t::duration{};
+        for (auto frame = 0; frame < frames; ++frame) {
+            const auto start = Clock_t::now();
+            put_frame();
+            elapsed += Clock_t::now() - start;
+            output::refresh();
+        }
+        const auto seconds = std::chrono::duration<double>(elapsed).count();
+        const auto result =
+            static_cast<double>(width * height * frames) / seconds / 1e6;
+        best = result > best ? result : best;
+    }
+    return best;
+}
+
+void bench(const char* name, const std::vector<Glyph>& frame) {
+    const auto single = throughput([&frame] {
+        for (auto y = std::size_t{0}; y < height; ++y) {
+            for (auto x = std::size_t{0}; x < width; ++x) {
+                output::put(x, y, frame[y * width + x]);
+            }
+        }
+    });
+    const auto runs = throughput([&frame] {
+        for (auto y = std::size_t{0}; y < height; ++y) {
+            for (auto x = std::size_t{0}; x < width; x += run_length) {
+                output::put(x, y, &frame[y * width + x], run_length);
+            }
+        }
+    });
+    std::cerr << std::setw(17) << std::left << name << std::fixed
+              << std::setprecision(2) << "single " << std::setw(8) << single
+              << "runs of " << run_length << " " << runs
+              << " million Glyphs/s\n";
+}
+
+}  // namespace
+
+int main() {
+    // Frames go to /dev/null, results to stderr.
+    auto* null_out = std::fopen("/dev/null", "w");
+    ::dup2(::fileno(null_out), STDOUT_FILENO);
+    ::setenv("TERM", "xterm-256color", 0);
+    ::newterm(nullptr, null_out, stdin);
+    ::resizeterm(static_cast<int>(height), static_cast<int>(width));
+    ::start_color();
+    const auto frame = make_frame();
+    std::cerr << width << "x" << height << " Glyphs, " << frames
+              << " frames, best of " << repeats << "\n";
+    bench("ncurses", frame);
+    System::terminal.set_output_backend(Output_backend::Escape_sequence);
+    bench("escape sequence", frame);
+    ::endwin();
+}
@@ -0,0 +1,133 @@
+// Compares the cell grid Screen_descriptor with the hash map it replaced, for
+// one frame of a 300x100 terminal: every cell painted, looked up when composed
+// and iterated when committed.
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <unordered_map>
+
+#include <cppurses/painter/detail/screen_descriptor.hpp>
+#include <cppurses/painter/glyph.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/point.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+using Clock_t = std::chrono::steady_clock;
+
+const auto width = std::size_t{300};
+const auto height = std::size_t{100};
+const auto frames = 200;
+
+/// Written with what was committed, so the work is not optimized away.
+volatile std::size_t checksum{0};
+
+/// Screen_descriptor before the cell grid.
+using Map_descriptor = std::unordered_map<Point, Glyph>;
+
+/// Nanoseconds per cell spent in each phase of a frame.
+struct Timings {
+    double paint{0.0};
+    double compose{0.0};
+    double commit{0.0};
+};
+
+double ns_per_cell(Clock_t::duration d) {
+    return std::chrono::duration<double, std::nano>(d).count() /
+           (static_cast<double>(width * height) * frames);
+}
+
+template <typename Paint, typename Compose, typename Commit>
+Timings run(Paint&& paint, Compose&& compose, Commit&& commit) {
+    auto totals = Timings{};
+    auto paint_time = Clock_t::duration{};
+    auto compose_time = Clock_t::duration{};
+    auto commit_time = Clock_t::duration{};
+    for (auto frame = 0; frame < frames; ++frame) {
+        const auto glyph = Glyph{static_cast<wchar_t>(L'a' + frame % 26)};
+        const auto t0 = Clock_t::now();
+        for (auto y = std::size_t{0}; y < height; ++y) {
+            for (auto x = std::size_t{0}; x < width; ++x) {
+                paint(Point{x, y}, glyph);
+            }
+        }
+        const auto t1 = Clock_t::now();
+        for (auto y = std::size_t{0}; y < height; ++y) {
+            for (auto x = std::size_t{0}; x < width; ++x) {
+                compose(Point{x, y});
+            }
+        }
+        const auto t2 = Clock_t::now();
+        commit();
+        const auto t3 = Clock_t::now();
+        paint_time += t1 - t0;
+        compose_time += t2 - t1;
+        commit_time += t3 - t2;
+    }
+    totals.paint = ns_per_cell(paint_time);
+    totals.compose = ns_per_cell(compose_time);
+    totals.commit = ns_per_cell(commit_time);
+    return totals;
+}
+
+Timings run_map() {
+    Map_descriptor staged;
+    Map_descriptor back;
+    auto result = run(
+        [&](const Point& p, const Glyph& g) { staged[p] = g; },
+        [&](const Point& p) {
+            const auto found = staged.find(p);
+            if (found != std::end(staged)) {
+                back[p] = found->second;
+            }
+        },
+        [&] {
+            for (const auto& cell : back) {
+                checksum = checksum + cell.second.symbol;
+            }
+            back.clear();
+            staged.clear();
+        });
+    return result;
+}
+
+Timings run_grid() {
+    detail::Screen_descriptor staged{Point{0, 0}, Area{width, height}};
+    detail::Screen_descriptor back{Point{0, 0}, Area{width, height}};
+    auto result = run(
+        [&](const Point& p, const Glyph& g) { staged.set(p, g); },
+        [&](const Point& p) {
+            if (staged.contains(p)) {
+                back.set(p, staged.at(p));
+            }
+        },
+        [&] {
+            back.for_each([](const Point&, const Glyph& g) {
+                checksum = checksum + g.symbol;
+            });
+            back.clear();
+            staged.clear();
+        });
+    return result;
+}
+
+void print(const char* name, const Timings& t) {
+    std::cout << std::setw(15) << std::left << name << std::fixed
+              << std::setprecision(1) << "paint " << std::setw(8) << t.paint
+              << "compose " << std::setw(8) << t.compose << "commit "
+              << std::setw(8) << t.commit << "total "
+              << t.paint + t.compose + t.commit << " ns/cell\n";
+}
+
+}  // namespace
+
+int main() {
+    std::cout << width << "x" << height << " cells, " << frames << " frames\n";
+    const auto map = run_map();
+    const auto grid = run_grid();
+    print("unordered_map", map);
+    print("cell grid", grid);
+}
@@ -1,7 +1,128 @@
-#include <system/event_loop.hpp>
+#include <cppurses/system/event_loop.hpp>
+
+#include <functional>
+#include <memory>
+#include <utility>
 
 #include <gtest/gtest.h>
 
-TEST(EventLoopTest, Default) {
+#include <cppurses/system/event.hpp>
+#include <cppurses/system/events/move_event.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/widget.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+// Processes the Events posted before run() once, then exits.
+class Once_loop : public Event_loop {
+   protected:
+    void loop_function() override { this->exit(0); }
+};
+
+// Calls a function when sent.
+class Call_event : public Event {
+   public:
+    Call_event(Widget& receiver, std::function<void()> call)
+        : Event{Event::Custom, receiver}, call_{std::move(call)} {}
+
+    bool send() const override {
+        call_();
+        return true;
+    }
+
+    bool filter_send(Widget&) const override { return false; }
+
+   private:
+    std::function<void()> call_;
+};
+
+// Counts the Events it is sent.
+class Counter : public Widget {
+   public:
+    explicit Counter(int& moves, int& deletes)
+        : moves_{moves}, deletes_{deletes} {
+        this->enable();
+    }
+
+   protected:
+    bool move_event(Point new_position, Point old_position) override {
+        ++moves_;
+        return Widget::move_event(new_position, old_position);
+    }
+
+    bool delete_event() override {
+        ++deletes_;
+        return Widget::delete_event();
+    }
+
+   private:
+    int& moves_;
+    int& deletes_;
+};
+
+}  // namespace
+
+TEST(EventLoopTest, WidgetDestroyedByEarlierEventInBatch) {
+    auto moves = 0;
+    auto deletes = 0;
+    Counter parent{moves, deletes};
+    auto& doomed = parent.make_child<Counter>(moves, deletes);
+    auto& sibling = parent.make_child<Counter>(moves, deletes);
+
+    Once_loop loop;
+    loop.post_event(std::make_unique<Call_event>(
+        parent, [&] { parent.children.remove(&doomed); }));
+    loop.post_event(std::make_unique<Move_event>(doomed, Point{1, 1}));
+    loop.post_event(std::make_unique<Move_event>(sibling, Point{1, 1}));
+    EXPECT_EQ(0, loop.run());
+
+    // doomed was destroyed before its Move_event came up in the batch.
+    EXPECT_EQ(1, moves);
+    EXPECT_EQ(0, deletes);
+    EXPECT_EQ(1u, parent.children.get().size());
+}
+
+TEST(EventLoopTest, ParentAndChildClosedInSameFrame) {
+    auto moves = 0;
+    auto deletes = 0;
+    Counter root{moves, deletes};
+    auto& parent = root.make_child<Counter>(moves, deletes);
+    auto& child = parent.make_child<Counter>(moves, deletes);
+    auto& grandchild = child.make_child<Counter>(moves, deletes);
+
+    Once_loop loop;
+    loop.post_event(std::make_unique<Move_event>(grandchild, Point{1, 1}));
+    loop.post_event(std::make_unique<Call_event>(root, [&] {
+        child.close();
+        parent.close();
+    }));
+    loop.post_event(std::make_unique<Move_event>(child, Point{1, 1}));
+    loop.post_event(std::make_unique<Move_event>(parent, Point{1, 1}));
+    EXPECT_EQ(0, loop.run());
+
+    EXPECT_EQ(1, moves);
+    EXPECT_EQ(3, deletes);
+    EXPECT_TRUE(root.children.get().empty());
+}
+
+TEST(EventLoopTest, ChildClosedAfterParentInSameFrame) {
+    auto moves = 0;
+    auto deletes = 0;
+    Counter root{moves, deletes};
+    auto& parent = root.make_child<Counter>(moves, deletes);
+    auto& child = parent.make_child<Counter>(moves, deletes);
+
+    Once_loop loop;
+    loop.post_event(std::make_unique<Call_event>(root, [&] {
+        parent.close();
+        child.close();
+    }));
+    loop.post_event(std::make_unique<Move_event>(child, Point{1, 1}));
+    EXPECT_EQ(0, loop.run());
 
+    EXPECT_EQ(0, moves);
+    EXPECT_EQ(2, deletes);
+    EXPECT_TRUE(root.children.get().empty());
 }
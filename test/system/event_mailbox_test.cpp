@@ -0,0 +1,93 @@
+#include <cppurses/system/detail/event_mailbox.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cppurses/system/event.hpp>
+#include <cppurses/widget/widget.hpp>
+
+using namespace cppurses;
+using cppurses::detail::Event_mailbox;
+
+namespace {
+
+// Carries the order it was pushed in.
+class Numbered_event : public Event {
+   public:
+    Numbered_event(Widget& receiver, std::size_t n)
+        : Event{Event::Custom, receiver}, n_{n} {}
+
+    bool send() const override { return true; }
+    bool filter_send(Widget&) const override { return false; }
+
+    std::size_t n() const { return n_; }
+
+   private:
+    std::size_t n_;
+};
+
+std::size_t number(const std::unique_ptr<Event>& event) {
+    return static_cast<const Numbered_event&>(*event).n();
+}
+
+}  // namespace
+
+TEST(EventMailboxTest, TakeAllInPushOrder) {
+    Widget w;
+    Event_mailbox mailbox;
+    mailbox.push(std::make_unique<Numbered_event>(w, 0));
+    auto events = std::vector<std::unique_ptr<Event>>{};
+    events.push_back(std::make_unique<Numbered_event>(w, 1));
+    events.push_back(nullptr);
+    events.push_back(std::make_unique<Numbered_event>(w, 2));
+    mailbox.push_all(std::move(events));
+    mailbox.push(nullptr);
+    mailbox.push(std::make_unique<Numbered_event>(w, 3));
+
+    auto taken = std::vector<std::size_t>{};
+    mailbox.take_all([&taken](std::unique_ptr<Event> event) {
+        taken.push_back(number(event));
+    });
+    EXPECT_EQ((std::vector<std::size_t>{0, 1, 2, 3}), taken);
+
+    mailbox.take_all([](std::unique_ptr<Event>) { FAIL(); });
+}
+
+TEST(EventMailboxTest, PushFromManyThreads) {
+    const auto threads = std::size_t{4};
+    const auto per_thread = std::size_t{20000};
+    Widget w;
+    Event_mailbox mailbox;
+    auto next = std::vector<std::size_t>(threads, 0);
+    auto taken = std::size_t{0};
+    const auto take = [&] {
+        mailbox.take_all([&](std::unique_ptr<Event> event) {
+            const auto n = number(event);
+            // Events from one thread arrive in the order they were pushed.
+            EXPECT_EQ(next[n / per_thread], n % per_thread);
+            next[n / per_thread] = n % per_thread + 1;
+            ++taken;
+        });
+    };
+    auto producers = std::vector<std::thread>{};
+    for (auto t = std::size_t{0}; t < threads; ++t) {
+        producers.emplace_back([&mailbox, &w, t, per_thread] {
+            for (auto i = std::size_t{0}; i < per_thread; ++i) {
+                mailbox.push(
+                    std::make_unique<Numbered_event>(w, t * per_thread + i));
+            }
+        });
+    }
+    while (taken < threads * per_thread / 2) {
+        take();
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    take();
+    EXPECT_EQ(threads * per_thread, taken);
+}
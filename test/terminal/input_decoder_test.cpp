@@ -0,0 +1,252 @@
+#include <cppurses/terminal/detail/input_decoder.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cppurses/system/key.hpp>
+#include <cppurses/system/mouse_button.hpp>
+
+using namespace cppurses;
+using cppurses::detail::Decoded_input;
+using cppurses::detail::Input_decoder;
+
+namespace {
+
+using Kind = Decoded_input::Kind;
+
+void feed(Input_decoder& decoder, const std::string& bytes) {
+    decoder.feed(bytes.data(), bytes.size());
+}
+
+std::vector<Decoded_input> decode_all(Input_decoder& decoder) {
+    auto decoded = std::vector<Decoded_input>{};
+    auto input = Decoded_input{};
+    while (decoder.next(input)) {
+        decoded.push_back(input);
+    }
+    return decoded;
+}
+
+/// Returns the Keys decoded from \p bytes, in order.
+std::vector<Key> keys(const std::string& bytes) {
+    Input_decoder decoder;
+    feed(decoder, bytes);
+    auto result = std::vector<Key>{};
+    for (const auto& input : decode_all(decoder)) {
+        EXPECT_EQ(Kind::Key, input.kind);
+        result.push_back(input.key);
+    }
+    return result;
+}
+
+Key function(int n) {
+    return static_cast<Key>(static_cast<short>(Key::Function) + n);
+}
+
+Key byte(char c) {
+    return static_cast<Key>(c);
+}
+
+void expect_mouse(const Decoded_input& input,
+                  Kind kind,
+                  Mouse_button button,
+                  std::size_t x,
+                  std::size_t y) {
+    EXPECT_EQ(kind, input.kind);
+    EXPECT_EQ(button, input.button);
+    EXPECT_EQ(x, input.x);
+    EXPECT_EQ(y, input.y);
+}
+
+/// An X10 mouse report, \p x and \p y are zero based.
+std::string x10_report(int code, int x, int y) {
+    return std::string{"\x1b[M"} + static_cast<char>(code + 32) +
+           static_cast<char>(x + 33) + static_cast<char>(y + 33);
+}
+
+}  // namespace
+
+TEST(InputDecoderTest, PlainBytes) {
+    EXPECT_EQ((std::vector<Key>{Key::a, byte('Z'), Key::Enter, Key::Tab}),
+              keys("aZ\r\t"));
+}
+
+TEST(InputDecoderTest, CsiArrowKeys) {
+    EXPECT_EQ((std::vector<Key>{Key::Arrow_up, Key::Arrow_down,
+                                Key::Arrow_right, Key::Arrow_left}),
+              keys("\x1b[A\x1b[B\x1b[C\x1b[D"));
+}
+
+TEST(InputDecoderTest, ShiftArrowKeysMatchNcurses) {
+    EXPECT_EQ((std::vector<Key>{Key::Scroll_backward, Key::Scroll_forward,
+                                Key::Shift_right_arrow,
+                                Key::Shift_left_arrow}),
+              keys("\x1b[1;2A\x1b[1;2B\x1b[1;2C\x1b[1;2D"));
+}
+
+TEST(InputDecoderTest, HomeEndAndBackTab) {
+    EXPECT_EQ((std::vector<Key>{Key::Home, Key::End, Key::Shift_home,
+                                Key::Shift_end, Key::Back_tab}),
+              keys("\x1b[H\x1b[F\x1b[1;2H\x1b[1;2F\x1b[Z"));
+}
+
+TEST(InputDecoderTest, Ss3Keys) {
+    EXPECT_EQ((std::vector<Key>{Key::Arrow_up, Key::Home, function(1),
+                                function(4), Key::Enter}),
+              keys("\x1bOA\x1bOH\x1bOP\x1bOS\x1bOM"));
+}
+
+TEST(InputDecoderTest, TildeKeys) {
+    EXPECT_EQ((std::vector<Key>{Key::Insert_character, Key::Delete_character,
+                                Key::Shift_delete_character,
+                                Key::Previous_page, Key::Next_page, Key::Home,
+                                Key::End}),
+              keys("\x1b[2~\x1b[3~\x1b[3;2~\x1b[5~\x1b[6~\x1b[1~\x1b[4~"));
+}
+
+TEST(InputDecoderTest, FunctionKeys) {
+    EXPECT_EQ((std::vector<Key>{function(5), function(6), function(10),
+                                function(11), function(12)}),
+              keys("\x1b[15~\x1b[17~\x1b[21~\x1b[23~\x1b[24~"));
+}
+
+TEST(InputDecoderTest, ModifiedFunctionKeys) {
+    // Numbered as ncurses does, shift + F1 is F13, ctrl + F1 is F25.
+    EXPECT_EQ((std::vector<Key>{function(13), function(25), function(17),
+                                function(36)}),
+              keys("\x1b[1;2P\x1b[1;5P\x1b[15;2~\x1b[24;5~"));
+}
+
+TEST(InputDecoderTest, UnknownSequencesAreSkipped) {
+    EXPECT_EQ((std::vector<Key>{Key::a, Key::b, Key::c}),
+              keys("\x1b[99~a\x1b[1;2Jb\x1bOXc"));
+}
+
+TEST(InputDecoderTest, EscapeBeforeKeyIsAlt) {
+    EXPECT_EQ((std::vector<Key>{Key::Escape, Key::x}), keys("\x1bx"));
+}
+
+TEST(InputDecoderTest, SgrMouse) {
+    Input_decoder decoder;
+    feed(decoder,
+         "\x1b[<0;10;5M\x1b[<0;10;5m\x1b[<2;1;1M\x1b[<1;80;24M"
+         "\x1b[<64;3;4M\x1b[<65;3;4M");
+    const auto decoded = decode_all(decoder);
+    ASSERT_EQ(6u, decoded.size());
+    expect_mouse(decoded[0], Kind::Mouse_press, Mouse_button::Left, 9, 4);
+    expect_mouse(decoded[1], Kind::Mouse_release, Mouse_button::Left, 9, 4);
+    expect_mouse(decoded[2], Kind::Mouse_press, Mouse_button::Right, 0, 0);
+    expect_mouse(decoded[3], Kind::Mouse_press, Mouse_button::Middle, 79, 23);
+    expect_mouse(decoded[4], Kind::Mouse_press, Mouse_button::ScrollUp, 2, 3);
+    expect_mouse(decoded[5], Kind::Mouse_press, Mouse_button::ScrollDown, 2,
+                 3);
+}
+
+TEST(InputDecoderTest, SgrMouseMotionAndWheelReleaseAreSkipped) {
+    Input_decoder decoder;
+    feed(decoder, "\x1b[<32;3;4M\x1b[<64;3;4m\x1b[<0;1;1Xa");
+    const auto decoded = decode_all(decoder);
+    ASSERT_EQ(1u, decoded.size());
+    EXPECT_EQ(Kind::Key, decoded[0].kind);
+    EXPECT_EQ(Key::a, decoded[0].key);
+}
+
+TEST(InputDecoderTest, X10Mouse) {
+    Input_decoder decoder;
+    feed(decoder, x10_report(2, 9, 4) + x10_report(3, 9, 4) +
+                      x10_report(64, 0, 0) + x10_report(32, 1, 1));
+    const auto decoded = decode_all(decoder);
+    ASSERT_EQ(3u, decoded.size());
+    expect_mouse(decoded[0], Kind::Mouse_press, Mouse_button::Right, 9, 4);
+    // X10 releases do not name the button, the last pressed is released.
+    expect_mouse(decoded[1], Kind::Mouse_release, Mouse_button::Right, 9, 4);
+    expect_mouse(decoded[2], Kind::Mouse_press, Mouse_button::ScrollUp, 0, 0);
+}
+
+TEST(InputDecoderTest, SequenceSplitAcrossReads) {
+    Input_decoder decoder;
+    auto input = Decoded_input{};
+    for (const char* part : {"\x1b", "[", "1;", "2"}) {
+        feed(decoder, part);
+        EXPECT_FALSE(decoder.next(input));
+        EXPECT_TRUE(decoder.pending());
+    }
+    feed(decoder, "Ca");
+    ASSERT_TRUE(decoder.next(input));
+    EXPECT_EQ(Key::Shift_right_arrow, input.key);
+    ASSERT_TRUE(decoder.next(input));
+    EXPECT_EQ(Key::a, input.key);
+    EXPECT_FALSE(decoder.next(input));
+    EXPECT_FALSE(decoder.pending());
+}
+
+TEST(InputDecoderTest, MouseReportsSplitAcrossReads) {
+    Input_decoder decoder;
+    auto input = Decoded_input{};
+    feed(decoder, "\x1b[<0;1");
+    EXPECT_FALSE(decoder.next(input));
+    feed(decoder, "0;5M");
+    ASSERT_TRUE(decoder.next(input));
+    expect_mouse(input, Kind::Mouse_press, Mouse_button::Left, 9, 4);
+
+    const auto report = x10_report(0, 2, 3);
+    feed(decoder, report.substr(0, 4));
+    EXPECT_FALSE(decoder.next(input));
+    feed(decoder, report.substr(4));
+    ASSERT_TRUE(decoder.next(input));
+    expect_mouse(input, Kind::Mouse_press, Mouse_button::Left, 2, 3);
+}
+
+TEST(InputDecoderTest, LoneEscapeIsFlushed) {
+    Input_decoder decoder;
+    auto input = Decoded_input{};
+    feed(decoder, "\x1b");
+    EXPECT_FALSE(decoder.next(input));
+    EXPECT_TRUE(decoder.pending());
+    decoder.flush();
+    ASSERT_TRUE(decoder.next(input));
+    EXPECT_EQ(Key::Escape, input.key);
+    EXPECT_FALSE(decoder.next(input));
+    EXPECT_FALSE(decoder.pending());
+
+    // Flushing only applies to the input pending when it was called.
+    feed(decoder, "\x1b");
+    EXPECT_FALSE(decoder.next(input));
+    EXPECT_TRUE(decoder.pending());
+}
+
+TEST(InputDecoderTest, FlushedIncompleteSequenceIsKeys) {
+    Input_decoder decoder;
+    feed(decoder, "\x1b[1;");
+    decoder.flush();
+    const auto decoded = decode_all(decoder);
+    ASSERT_EQ(4u, decoded.size());
+    EXPECT_EQ(Key::Escape, decoded[0].key);
+    EXPECT_EQ(byte('['), decoded[1].key);
+    EXPECT_EQ(byte('1'), decoded[2].key);
+    EXPECT_EQ(byte(';'), decoded[3].key);
+}
+
+TEST(InputDecoderTest, OverLongCsiIsNotWaitedOn) {
+    const auto digits = std::string(40, '1');
+    const auto decoded = keys("\x1b[" + digits);
+    ASSERT_EQ(2 + digits.size(), decoded.size());
+    EXPECT_EQ(Key::Escape, decoded[0]);
+    EXPECT_EQ(byte('['), decoded[1]);
+    EXPECT_EQ(byte('1'), decoded.back());
+
+    // Shorter than the limit, the rest of the sequence is waited for.
+    Input_decoder decoder;
+    feed(decoder, "\x1b[" + std::string(20, '1'));
+    EXPECT_TRUE(decode_all(decoder).empty());
+    EXPECT_TRUE(decoder.pending());
+}
+
+TEST(InputDecoderTest, InvalidCsiByteEndsSequence) {
+    EXPECT_EQ((std::vector<Key>{Key::Escape, byte('['), byte('1'),
+                                static_cast<Key>(1)}),
+              keys("\x1b[1\x01"));
+}
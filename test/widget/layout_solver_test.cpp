@@ -0,0 +1,461 @@
+#include <cppurses/widget/detail/layout_solver.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cppurses/widget/size_policy.hpp>
+
+using cppurses::Size_policy;
+using cppurses::detail::Layout_solver;
+
+namespace {
+
+// Stands in for Size_policy, which needs an owning Widget.
+struct Policy {
+    Size_policy::Type type_;
+    std::size_t stretch_;
+    std::size_t min_;
+    std::size_t max_;
+
+    Size_policy::Type type() const { return type_; }
+    std::size_t stretch() const { return stretch_; }
+    std::size_t min() const { return min_; }
+    std::size_t max() const { return max_; }
+};
+
+struct Element {
+    Policy policy;
+    std::size_t length;
+};
+
+struct Axis {
+    static const Policy& policy(const Element& e) { return e.policy; }
+    static std::size_t& length(Element& e) { return e.length; }
+};
+
+// Horizontal_layout::distribute_space() and collect_space() as they were
+// before Layout_solver, with Dimensions_reference replaced by Element*. The
+// horizontal copy is used, Vertical_layout's copy had the wrong sign when
+// clamping the first group and read the width stretch for the second group.
+// The one change is in collect_space(): the min() checks subtracted before
+// comparing, which wrapped around when a deduction was larger than the length.
+
+void reference_distribute(std::vector<Element*> widgets, int width_left) {
+    // Find total stretch of first group
+    std::size_t total_stretch{0};
+    for (const Element* d : widgets) {
+        auto policy = d->policy.type();
+        if (policy == Size_policy::Expanding ||
+            policy == Size_policy::MinimumExpanding) {
+            total_stretch += d->policy.stretch();
+        }
+    }
+
+    // Calculate new widths of widgets in new group, if any go over max_width
+    // then assign max value and recurse without that widget in vector.
+    std::deque<std::size_t> width_additions;
+    int index{0};
+    auto to_distribute = width_left;
+    for (Element* d : widgets) {
+        auto policy = d->policy.type();
+        if (policy == Size_policy::Expanding ||
+            policy == Size_policy::MinimumExpanding) {
+            width_additions.push_back(
+                (d->policy.stretch() / static_cast<double>(total_stretch)) *
+                to_distribute);
+            if ((d->length + width_additions.back()) > d->policy.max()) {
+                width_left -= d->policy.max() - d->length;
+                d->length = d->policy.max();
+                widgets.erase(std::begin(widgets) + index);
+                return reference_distribute(widgets, width_left);
+            }
+        }
+        ++index;
+    }
+
+    // If it has gotten this far, no widgets were over space, assign values
+    for (Element* d : widgets) {
+        auto policy = d->policy.type();
+        if (policy == Size_policy::Expanding ||
+            policy == Size_policy::MinimumExpanding) {
+            d->length += width_additions.front();
+            width_left -= width_additions.front();
+            width_additions.pop_front();
+        }
+    }
+
+    // SECOND GROUP - duplicate of above dependent on Policies to work with.
+    // Preferred and Minimum
+    if (width_left == 0) {
+        return;
+    }
+    // Find total stretch
+    total_stretch = 0;
+    for (const Element* d : widgets) {
+        auto policy = d->policy.type();
+        if (policy == Size_policy::Preferred ||
+            policy == Size_policy::Minimum || policy == Size_policy::Ignored) {
+            total_stretch += d->policy.stretch();
+        }
+    }
+
+    // Calculate new widths of widgets in new group, if any go over max_width
+    // then assign max value and recurse without that widget in vector.
+    width_additions.clear();
+    index = 0;
+    to_distribute = width_left;
+    for (Element* d : widgets) {
+        auto policy = d->policy.type();
+        if (policy == Size_policy::Preferred ||
+            policy == Size_policy::Minimum || policy == Size_policy::Ignored) {
+            width_additions.push_back(
+                (d->policy.stretch() / static_cast<double>(total_stretch)) *
+                to_distribute);
+            if ((d->length + width_additions.back()) > d->policy.max()) {
+                width_left -= d->policy.max() - d->length;
+                d->length = d->policy.max();
+                widgets.erase(std::begin(widgets) + index);
+                return reference_distribute(widgets, width_left);
+            }
+        }
+        ++index;
+    }
+
+    // If it has gotten this far, no widgets were over space, assign values
+    for (Element* d : widgets) {
+        auto policy = d->policy.type();
+        if (policy == Size_policy::Preferred ||
+            policy == Size_policy::Minimum || policy == Size_policy::Ignored) {
+            d->length += width_additions.front();
+            width_left -= width_additions.front();
+            width_additions.pop_front();
+        }
+    }
+
+    if (width_left == 0) {
+        return;
+    }
+    // Rounding error extra
+    // First Group
+    auto width_check{0};
+    do {
+        width_check = width_left;
+        for (Element* d : widgets) {
+            auto policy = d->policy.type();
+            if ((policy == Size_policy::Expanding ||
+                 policy == Size_policy::MinimumExpanding) &&
+                width_left > 0) {
+                if (d->length + 1 <= d->policy.max()) {
+                    d->length += 1;
+                    width_left -= 1;
+                }
+            }
+        }
+    } while (width_check != width_left);
+
+    // Second Group
+    do {
+        width_check = width_left;
+        for (Element* d : widgets) {
+            auto policy = d->policy.type();
+            if ((policy == Size_policy::Preferred ||
+                 policy == Size_policy::Minimum ||
+                 policy == Size_policy::Ignored) &&
+                width_left > 0) {
+                if (d->length + 1 <= d->policy.max()) {
+                    d->length += 1;
+                    width_left -= 1;
+                }
+            }
+        }
+    } while (width_check != width_left);
+}
+
+void reference_collect(std::vector<Element*> widgets, int width_left) {
+    if (width_left == 0) {
+        return;
+    }
+    // Find total stretch of first group
+    std::size_t total_stretch{0};
+    for (const Element* d : widgets) {
+        auto policy = d->policy.type();
+        if (policy == Size_policy::Maximum ||
+            policy == Size_policy::Preferred ||
+            policy == Size_policy::Ignored) {
+            total_stretch += d->policy.stretch();
+        }
+    }
+
+    // Find total of inverse of percentages
+    double total_inverse{0};
+    for (const Element* d : widgets) {
+        auto policy = d->policy.type();
+        if (policy == Size_policy::Maximum ||
+            policy == Size_policy::Preferred ||
+            policy == Size_policy::Ignored) {
+            total_inverse += 1 / (d->policy.stretch() /
+                                  static_cast<double>(total_stretch));
+        }
+    }
+
+    // Calculate new widths of widgets in new group, if any go under min_width
+    // then assign min value and recurse without that widget in vector.
+    std::deque<std::size_t> width_deductions;
+    int index{0};
+    auto to_collect = width_left;
+    for (Element* d : widgets) {
+        auto policy = d->policy.type();
+        if (policy == Size_policy::Maximum ||
+            policy == Size_policy::Preferred ||
+            policy == Size_policy::Ignored) {
+            width_deductions.push_back(
+                ((1 / (d->policy.stretch() /
+                       static_cast<double>(total_stretch))) /
+                 static_cast<double>(total_inverse)) *
+                (to_collect * -1));
+            // Was (length - deduction) < min.
+            if (d->length < width_deductions.back() + d->policy.min()) {
+                width_left += d->length - d->policy.min();
+                d->length = d->policy.min();
+                widgets.erase(std::begin(widgets) + index);
+                return reference_collect(widgets, width_left);
+            }
+        }
+        ++index;
+    }
+
+    // If it has gotten this far, no widgets were over space, assign calculated
+    // values
+    for (Element* d : widgets) {
+        auto policy = d->policy.type();
+        if (policy == Size_policy::Maximum ||
+            policy == Size_policy::Preferred ||
+            policy == Size_policy::Ignored) {
+            if (d->length >= width_deductions.front()) {
+                d->length -= width_deductions.front();
+            } else {
+                d->length = 0;
+            }
+            width_left += width_deductions.front();
+            width_deductions.pop_front();
+        }
+    }
+
+    // SECOND GROUP - duplicate of above dependent on Policies to work with.
+    if (width_left == 0) {
+        return;
+    }
+    // Find total stretch
+    total_stretch = 0;
+    for (const Element* d : widgets) {
+        auto policy = d->policy.type();
+        if (policy == Size_policy::Expanding) {
+            total_stretch += d->policy.stretch();
+        }
+    }
+
+    // Find total of inverse of percentages
+    total_inverse = 0;
+    for (const Element* d : widgets) {
+        auto policy = d->policy.type();
+        if (policy == Size_policy::Expanding) {
+            total_inverse += 1 / (d->policy.stretch() /
+                                  static_cast<double>(total_stretch));
+        }
+    }
+
+    // Calculate new widths of widgets in new group, if any go over max_width
+    // then assign max value and recurse without that widget in vector.
+    width_deductions.clear();
+    index = 0;
+    to_collect = width_left;
+    for (Element* d : widgets) {
+        auto policy = d->policy.type();
+        if (policy == Size_policy::Expanding) {
+            width_deductions.push_back(
+                ((1 / (d->policy.stretch() /
+                       static_cast<double>(total_stretch))) /
+                 static_cast<double>(total_inverse)) *
+                (to_collect * -1));
+            // Was (length - deduction) < min.
+            if (d->length < width_deductions.back() + d->policy.min()) {
+                width_left += d->length - d->policy.min();
+                d->length = d->policy.min();
+                widgets.erase(std::begin(widgets) + index);
+                return reference_collect(widgets, width_left);
+            }
+        }
+        ++index;
+    }
+
+    // If it has gotten this far, no widgets were over space, assign calculated
+    // values
+    for (Element* d : widgets) {
+        auto policy = d->policy.type();
+        if (policy == Size_policy::Expanding) {
+            if (d->length >= width_deductions.front()) {
+                d->length -= width_deductions.front();
+            } else {
+                d->length = 0;
+            }
+            width_left += width_deductions.front();
+            width_deductions.pop_front();
+        }
+    }
+}
+
+std::vector<Element*> pointers(std::vector<Element>& elements) {
+    std::vector<Element*> result;
+    for (Element& e : elements) {
+        result.push_back(&e);
+    }
+    return result;
+}
+
+// Stretch factors are at least one, the reference divides by them.
+std::vector<Element> random_row(std::mt19937& gen) {
+    const auto pick = [&gen](std::size_t low, std::size_t high) {
+        return std::uniform_int_distribution<std::size_t>{low, high}(gen);
+    };
+    std::vector<Element> row(pick(0, 16));
+    for (Element& e : row) {
+        e.policy.type_ = static_cast<Size_policy::Type>(pick(0, 6));
+        e.policy.stretch_ = pick(1, 4);
+        e.policy.min_ = pick(0, 5);
+        e.policy.max_ = pick(0, 3) == 0
+                            ? std::numeric_limits<std::size_t>::max()
+                            : e.policy.min_ + pick(0, 20);
+        // Lengths start at the size hint, which can be outside [min, max].
+        e.length = pick(0, 9) == 0
+                       ? pick(0, 30)
+                       : pick(e.policy.min_,
+                              std::min(e.policy.max_, e.policy.min_ + 20));
+    }
+    return row;
+}
+
+}  // namespace
+
+TEST(LayoutSolverTest, DistributeMatchesPreviousLayouts) {
+    std::mt19937 gen{7};
+    Layout_solver<Axis> solver;
+    for (int i{0}; i < 50000; ++i) {
+        auto expected = random_row(gen);
+        auto actual = expected;
+        const auto space = std::uniform_int_distribution<int>{1, 120}(gen);
+        reference_distribute(pointers(expected), space);
+        solver.distribute(std::begin(actual), std::end(actual), space);
+        for (std::size_t j{0}; j < actual.size(); ++j) {
+            ASSERT_EQ(expected[j].length, actual[j].length) << "row " << i;
+        }
+    }
+}
+
+TEST(LayoutSolverTest, CollectMatchesPreviousLayouts) {
+    std::mt19937 gen{11};
+    Layout_solver<Axis> solver;
+    for (int i{0}; i < 50000; ++i) {
+        auto expected = random_row(gen);
+        auto actual = expected;
+        const auto space = std::uniform_int_distribution<int>{1, 120}(gen);
+        reference_collect(pointers(expected), -space);
+        solver.collect(std::begin(actual), std::end(actual), space);
+        for (std::size_t j{0}; j < actual.size(); ++j) {
+            ASSERT_EQ(expected[j].length, actual[j].length) << "row " << i;
+        }
+    }
+}
+
+// Clamping a Preferred Widget at its max starts sharing over from the
+// Expanding Widgets, so what is left goes to them before the other Preferred
+// Widgets.
+TEST(LayoutSolverTest, DistributeRestartsFromExpanding) {
+    std::vector<Element> row{
+        {Policy{Size_policy::Expanding, 3, 0, 100}, 0},
+        {Policy{Size_policy::Expanding, 1, 0, 100}, 0},
+        {Policy{Size_policy::Expanding, 1, 0, 100}, 0},
+        {Policy{Size_policy::Preferred, 1, 0, 0}, 0},
+        {Policy{Size_policy::Preferred, 1, 0, 100}, 0}};
+    auto expected = row;
+    reference_distribute(pointers(expected), 4);
+    Layout_solver<Axis> solver;
+    EXPECT_EQ(0, solver.distribute(std::begin(row), std::end(row), 4));
+    EXPECT_EQ(3, row[0].length);
+    EXPECT_EQ(0, row[1].length);
+    EXPECT_EQ(0, row[2].length);
+    EXPECT_EQ(0, row[3].length);
+    EXPECT_EQ(1, row[4].length);
+    for (std::size_t j{0}; j < row.size(); ++j) {
+        EXPECT_EQ(expected[j].length, row[j].length);
+    }
+}
+
+// Shares that land on a whole number are rounded as the Layouts always have.
+TEST(LayoutSolverTest, RoundingMatchesPreviousLayouts) {
+    for (std::size_t stretch{1}; stretch < 10; ++stretch) {
+        for (int space{1}; space < 200; ++space) {
+            std::vector<Element> row{
+                {Policy{Size_policy::Expanding, stretch, 0, 1000}, 0},
+                {Policy{Size_policy::Expanding, 3, 0, 1000}, 0},
+                {Policy{Size_policy::Expanding, 7, 0, 1000}, 0}};
+            auto expected = row;
+            reference_distribute(pointers(expected), space);
+            Layout_solver<Axis> solver;
+            solver.distribute(std::begin(row), std::end(row), space);
+            for (std::size_t j{0}; j < row.size(); ++j) {
+                ASSERT_EQ(expected[j].length, row[j].length);
+            }
+        }
+    }
+}
+
+// The previous Layouts divided by zero for a stretch factor of zero, now such
+// an element takes no share.
+TEST(LayoutSolverTest, ZeroStretchTakesNoShare) {
+    std::vector<Element> row{
+        {Policy{Size_policy::Expanding, 0, 0, 100}, 2},
+        {Policy{Size_policy::Expanding, 1, 0, 100}, 2},
+        {Policy{Size_policy::Preferred, 0, 1, 100}, 5}};
+    Layout_solver<Axis> solver;
+    EXPECT_EQ(0, solver.distribute(std::begin(row), std::end(row), 10));
+    EXPECT_EQ(2, row[0].length);
+    EXPECT_EQ(12, row[1].length);
+    EXPECT_EQ(5, row[2].length);
+    EXPECT_EQ(0, solver.collect(std::begin(row), std::end(row), 5));
+    EXPECT_EQ(2, row[0].length);
+    EXPECT_EQ(7, row[1].length);
+    EXPECT_EQ(5, row[2].length);
+}
+
+TEST(LayoutSolverTest, DistributeFillsSpace) {
+    std::vector<Element> row{
+        {Policy{Size_policy::Expanding, 1, 0, 5}, 0},
+        {Policy{Size_policy::Expanding, 2, 0, 100}, 0},
+        {Policy{Size_policy::Preferred, 1, 0, 100}, 3},
+        {Policy{Size_policy::Fixed, 1, 0, 100}, 4}};
+    Layout_solver<Axis> solver;
+    EXPECT_EQ(0, solver.distribute(std::begin(row), std::end(row), 30));
+    EXPECT_EQ(5, row[0].length);
+    EXPECT_EQ(25, row[1].length);
+    EXPECT_EQ(3, row[2].length);
+    EXPECT_EQ(4, row[3].length);
+}
+
+TEST(LayoutSolverTest, CollectStopsAtMin) {
+    std::vector<Element> row{
+        {Policy{Size_policy::Preferred, 1, 2, 100}, 4},
+        {Policy{Size_policy::Expanding, 1, 1, 100}, 3},
+        {Policy{Size_policy::Minimum, 1, 0, 100}, 5}};
+    Layout_solver<Axis> solver;
+    EXPECT_EQ(2, solver.collect(std::begin(row), std::end(row), 6));
+    EXPECT_EQ(2, row[0].length);
+    EXPECT_EQ(1, row[1].length);
+    EXPECT_EQ(5, row[2].length);
+}
@@ -0,0 +1,168 @@
+#include <cppurses/widget/layout.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cppurses/system/event_loop.hpp>
+#include <cppurses/system/events/move_event.hpp>
+#include <cppurses/system/events/resize_event.hpp>
+#include <cppurses/widget/area.hpp>
+#include <cppurses/widget/layouts/vertical_layout.hpp>
+#include <cppurses/widget/point.hpp>
+#include <cppurses/widget/size_policy.hpp>
+#include <cppurses/widget/widget.hpp>
+
+using namespace cppurses;
+
+namespace {
+
+// Processes the Events posted before run(), and those they post, then exits.
+class Once_loop : public Event_loop {
+   protected:
+    void loop_function() override { this->exit(0); }
+};
+
+// Counts the Move and Resize Events it is sent, five cells tall.
+class Leaf : public Widget {
+   public:
+    Leaf() {
+        this->height_policy.type(Size_policy::Fixed);
+        this->height_policy.hint(5);
+    }
+
+    int moves{0};
+    int resizes{0};
+
+    void reset_counts() {
+        moves = 0;
+        resizes = 0;
+    }
+
+   protected:
+    bool move_event(Point new_position, Point old_position) override {
+        ++moves;
+        return Widget::move_event(new_position, old_position);
+    }
+
+    bool resize_event(Area new_size, Area old_size) override {
+        ++resizes;
+        return Widget::resize_event(new_size, old_size);
+    }
+};
+
+// A Vertical_layout of three Leaves, placed at the origin.
+class LayoutTest : public ::testing::Test {
+   protected:
+    LayoutTest() {
+        for (auto i = 0; i < 3; ++i) {
+            leaves_.push_back(&layout_.make_child<Leaf>());
+        }
+        layout_.enable();
+        this->move(Point{0, 0});
+        this->resize(Area{30, 15});
+        this->reset_counts();
+    }
+
+    void move(Point position) {
+        Once_loop loop;
+        loop.post_event(std::make_unique<Move_event>(layout_, position));
+        loop.run();
+    }
+
+    void resize(Area size) {
+        Once_loop loop;
+        loop.post_event(std::make_unique<Resize_event>(layout_, size));
+        loop.run();
+    }
+
+    void reset_counts() {
+        for (Leaf* leaf : leaves_) {
+            leaf->reset_counts();
+        }
+    }
+
+    Vertical_layout layout_;
+    std::vector<Leaf*> leaves_;
+};
+
+}  // namespace
+
+TEST_F(LayoutTest, FirstLayoutPlacesEachChild) {
+    for (std::size_t i{0}; i < leaves_.size(); ++i) {
+        EXPECT_TRUE(leaves_[i]->enabled());
+        EXPECT_EQ(0u, leaves_[i]->x());
+        EXPECT_EQ(5 * i, leaves_[i]->y());
+        EXPECT_EQ(30u, leaves_[i]->width());
+        EXPECT_EQ(5u, leaves_[i]->height());
+    }
+}
+
+TEST_F(LayoutTest, SameSizeResizePostsNoChildEvents) {
+    this->resize(Area{30, 15});
+    for (Leaf* leaf : leaves_) {
+        EXPECT_EQ(0, leaf->moves);
+        EXPECT_EQ(0, leaf->resizes);
+    }
+}
+
+TEST_F(LayoutTest, CleanLayoutMoveShiftsChildren) {
+    this->move(Point{4, 2});
+    for (std::size_t i{0}; i < leaves_.size(); ++i) {
+        EXPECT_EQ(1, leaves_[i]->moves);
+        EXPECT_EQ(0, leaves_[i]->resizes);
+        EXPECT_EQ(4u, leaves_[i]->x());
+        EXPECT_EQ(2 + 5 * i, leaves_[i]->y());
+        EXPECT_EQ(30u, leaves_[i]->width());
+        EXPECT_EQ(5u, leaves_[i]->height());
+    }
+}
+
+TEST_F(LayoutTest, WidthChangeOnlyResizesChildren) {
+    this->resize(Area{20, 15});
+    for (Leaf* leaf : leaves_) {
+        EXPECT_EQ(0, leaf->moves);
+        EXPECT_EQ(1, leaf->resizes);
+        EXPECT_EQ(20u, leaf->width());
+    }
+}
+
+TEST_F(LayoutTest, ReenabledChildGetsMoveAndResize) {
+    Leaf& last = *leaves_.back();
+    this->resize(Area{30, 10});
+    EXPECT_FALSE(last.enabled());
+
+    // Only the placed children are shifted, the disabled child is not.
+    this->move(Point{4, 2});
+    this->reset_counts();
+    this->resize(Area{30, 15});
+    EXPECT_TRUE(last.enabled());
+    EXPECT_EQ(1, last.moves);
+    EXPECT_EQ(1, last.resizes);
+    EXPECT_EQ(4u, last.x());
+    EXPECT_EQ(12u, last.y());
+    EXPECT_EQ(30u, last.width());
+    EXPECT_EQ(5u, last.height());
+    for (Leaf* leaf : {leaves_[0], leaves_[1]}) {
+        EXPECT_EQ(0, leaf->moves);
+        EXPECT_EQ(0, leaf->resizes);
+    }
+}
+
+TEST_F(LayoutTest, ReenabledChildIsResizedInPlace) {
+    Leaf& last = *leaves_.back();
+    this->resize(Area{30, 10});
+    EXPECT_FALSE(last.enabled());
+
+    // Back to the geometry it had before being disabled, the Resize_event is
+    // still sent. A Move_event to an unchanged position is not sent.
+    this->reset_counts();
+    this->resize(Area{30, 15});
+    EXPECT_TRUE(last.enabled());
+    EXPECT_EQ(1, last.resizes);
+    EXPECT_EQ(0u, last.x());
+    EXPECT_EQ(10u, last.y());
+    EXPECT_EQ(5u, last.height());
+}